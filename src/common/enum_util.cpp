@@ -1195,6 +1195,8 @@ const char* EnumUtil::ToChars<CompressionType>(CompressionType value) {
 		return "COMPRESSION_ALP";
 	case CompressionType::COMPRESSION_ALPRD:
 		return "COMPRESSION_ALPRD";
+	case CompressionType::COMPRESSION_ZSTD:
+		return "COMPRESSION_ZSTD";
 	case CompressionType::COMPRESSION_COUNT:
 		return "COMPRESSION_COUNT";
 	default:
@@ -1240,6 +1242,9 @@ CompressionType EnumUtil::FromString<CompressionType>(const char *value) {
 	if (StringUtil::Equals(value, "COMPRESSION_ALPRD")) {
 		return CompressionType::COMPRESSION_ALPRD;
 	}
+	if (StringUtil::Equals(value, "COMPRESSION_ZSTD")) {
+		return CompressionType::COMPRESSION_ZSTD;
+	}
 	if (StringUtil::Equals(value, "COMPRESSION_COUNT")) {
 		return CompressionType::COMPRESSION_COUNT;
 	}
@@ -4357,6 +4362,8 @@ const char* EnumUtil::ToChars<OptimizerType>(OptimizerType value) {
 		return "DUPLICATE_GROUPS";
 	case OptimizerType::REORDER_FILTER:
 		return "REORDER_FILTER";
+	case OptimizerType::JOIN_FILTER_PUSHDOWN:
+		return "JOIN_FILTER_PUSHDOWN";
 	case OptimizerType::EXTENSION:
 		return "EXTENSION";
 	default:
@@ -4420,6 +4427,9 @@ OptimizerType EnumUtil::FromString<OptimizerType>(const char *value) {
 	if (StringUtil::Equals(value, "REORDER_FILTER")) {
 		return OptimizerType::REORDER_FILTER;
 	}
+	if (StringUtil::Equals(value, "JOIN_FILTER_PUSHDOWN")) {
+		return OptimizerType::JOIN_FILTER_PUSHDOWN;
+	}
 	if (StringUtil::Equals(value, "EXTENSION")) {
 		return OptimizerType::EXTENSION;
 	}
@@ -6782,6 +6792,8 @@ const char* EnumUtil::ToChars<TableFilterType>(TableFilterType value) {
 		return "CONJUNCTION_AND";
 	case TableFilterType::STRUCT_EXTRACT:
 		return "STRUCT_EXTRACT";
+	case TableFilterType::DYNAMIC_FILTER:
+		return "DYNAMIC_FILTER";
 	default:
 		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
 	}
@@ -6807,6 +6819,32 @@ TableFilterType EnumUtil::FromString<TableFilterType>(const char *value) {
 	if (StringUtil::Equals(value, "STRUCT_EXTRACT")) {
 		return TableFilterType::STRUCT_EXTRACT;
 	}
+	if (StringUtil::Equals(value, "DYNAMIC_FILTER")) {
+		return TableFilterType::DYNAMIC_FILTER;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
+}
+
+template<>
+const char* EnumUtil::ToChars<TableFunctionInitialization>(TableFunctionInitialization value) {
+	switch(value) {
+	case TableFunctionInitialization::INITIALIZE_ON_EXECUTE:
+		return "INITIALIZE_ON_EXECUTE";
+	case TableFunctionInitialization::INITIALIZE_ON_SCHEDULE:
+		return "INITIALIZE_ON_SCHEDULE";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
+	}
+}
+
+template<>
+TableFunctionInitialization EnumUtil::FromString<TableFunctionInitialization>(const char *value) {
+	if (StringUtil::Equals(value, "INITIALIZE_ON_EXECUTE")) {
+		return TableFunctionInitialization::INITIALIZE_ON_EXECUTE;
+	}
+	if (StringUtil::Equals(value, "INITIALIZE_ON_SCHEDULE")) {
+		return TableFunctionInitialization::INITIALIZE_ON_SCHEDULE;
+	}
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
@@ -54,7 +54,7 @@ void TemplatedRadixScatter(UnifiedVectorFormat &vdata, const SelectionVector &se
 
 void RadixScatterStringVector(UnifiedVectorFormat &vdata, const SelectionVector &sel, idx_t add_count,
                               data_ptr_t *key_locations, const bool desc, const bool has_null, const bool nulls_first,
-                              const idx_t prefix_len, idx_t offset) {
+                              const idx_t prefix_len, idx_t offset, const string &common_prefix) {
 	auto source = UnifiedVectorFormat::GetData<string_t>(vdata);
 	if (has_null) {
 		auto &validity = vdata.validity;
@@ -67,7 +67,7 @@ void RadixScatterStringVector(UnifiedVectorFormat &vdata, const SelectionVector
 			// write validity and according value
 			if (validity.RowIsValid(source_idx)) {
 				key_locations[i][0] = valid;
-				Radix::EncodeStringDataPrefix(key_locations[i] + 1, source[source_idx], prefix_len);
+				Radix::EncodeStringDataPrefix(key_locations[i] + 1, source[source_idx], prefix_len, common_prefix);
 				// invert bits if desc
 				if (desc) {
 					for (idx_t s = 1; s < prefix_len + 1; s++) {
@@ -85,7 +85,7 @@ void RadixScatterStringVector(UnifiedVectorFormat &vdata, const SelectionVector
 			auto idx = sel.get_index(i);
 			auto source_idx = vdata.sel->get_index(idx) + offset;
 			// write value
-			Radix::EncodeStringDataPrefix(key_locations[i], source[source_idx], prefix_len);
+			Radix::EncodeStringDataPrefix(key_locations[i], source[source_idx], prefix_len, common_prefix);
 			// invert bits if desc
 			if (desc) {
 				for (idx_t s = 0; s < prefix_len; s++) {
@@ -255,7 +255,7 @@ void RadixScatterStructVector(Vector &v, UnifiedVectorFormat &vdata, idx_t vcoun
 
 void RowOperations::RadixScatter(Vector &v, idx_t vcount, const SelectionVector &sel, idx_t ser_count,
                                  data_ptr_t *key_locations, bool desc, bool has_null, bool nulls_first,
-                                 idx_t prefix_len, idx_t width, idx_t offset) {
+                                 idx_t prefix_len, idx_t width, idx_t offset, const string &common_prefix) {
 	UnifiedVectorFormat vdata;
 	v.ToUnifiedFormat(vcount, vdata);
 	switch (v.GetType().InternalType()) {
@@ -300,7 +300,8 @@ void RowOperations::RadixScatter(Vector &v, idx_t vcount, const SelectionVector
 		TemplatedRadixScatter<interval_t>(vdata, sel, ser_count, key_locations, desc, has_null, nulls_first, offset);
 		break;
 	case PhysicalType::VARCHAR:
-		RadixScatterStringVector(vdata, sel, ser_count, key_locations, desc, has_null, nulls_first, prefix_len, offset);
+		RadixScatterStringVector(vdata, sel, ser_count, key_locations, desc, has_null, nulls_first, prefix_len, offset,
+		                         common_prefix);
 		break;
 	case PhysicalType::LIST:
 		RadixScatterListVector(v, vdata, sel, ser_count, key_locations, desc, has_null, nulls_first, prefix_len, width,
@@ -22,6 +22,10 @@ bool Comparators::TieIsBreakable(const idx_t &tie_col, const data_ptr_t &row_ptr
 		// Nested type, must be broken
 		return true;
 	}
+	if (!sort_layout.common_prefixes[tie_col].empty()) {
+		// The string may not start with the common prefix, in which case none of its bytes are in the radix key
+		return true;
+	}
 	const auto &tie_col_offset = row_layout.GetOffsets()[col_idx];
 	auto tie_string = Load<string_t>(row_ptr + tie_col_offset);
 	if (tie_string.GetSize() < sort_layout.prefix_lengths[tie_col]) {
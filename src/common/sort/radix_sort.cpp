@@ -1,3 +1,4 @@
+#include "duckdb/common/bswap.hpp"
 #include "duckdb/common/fast_mem.hpp"
 #include "duckdb/common/sort/comparators.hpp"
 #include "duckdb/common/sort/duckdb_pdqsort.hpp"
@@ -5,7 +6,67 @@
 
 namespace duckdb {
 
-//! Calls std::sort on strings that are tied by their prefix after the radix sort
+//! A string that is tied with other strings on the bytes that were already compared
+struct TiedStringEntry {
+	//! The next 8 bytes of the string (big-endian and zero-padded, so they compare like the string bytes)
+	uint64_t window;
+	//! The length of the string, capped at one past the window (longer strings are tied on length)
+	idx_t length;
+	//! The string, and the radix sorting row that it belongs to
+	string_t str;
+	data_ptr_t row_ptr;
+};
+
+static void FillTiedStringWindow(TiedStringEntry &entry, const idx_t offset) {
+	const auto len = entry.str.GetSize();
+	data_t bytes[sizeof(uint64_t)] = {};
+	if (len > offset) {
+		memcpy(bytes, entry.str.GetData() + offset, MinValue<idx_t>(len - offset, sizeof(uint64_t)));
+	}
+	entry.window = BSwap<uint64_t>(Load<uint64_t>(bytes));
+	entry.length = MinValue<idx_t>(len, offset + sizeof(uint64_t) + 1);
+}
+
+//! Sorts strings that are equal up to 'offset' bytes (zero-padded) on successive 8-byte windows of the strings
+//! Only the ranges that are still tied on a window are sorted on the next window (MSD radix sort-style)
+static void SortTiedStrings(TiedStringEntry *entries, const idx_t count, const idx_t offset, const bool desc) {
+	struct TiedStringRange {
+		idx_t begin;
+		idx_t end;
+		idx_t offset;
+	};
+	vector<TiedStringRange> ranges;
+	ranges.push_back({0, count, offset});
+	while (!ranges.empty()) {
+		const auto range = ranges.back();
+		ranges.pop_back();
+		for (idx_t i = range.begin; i < range.end; i++) {
+			FillTiedStringWindow(entries[i], range.offset);
+		}
+		std::sort(entries + range.begin, entries + range.end,
+		          [desc](const TiedStringEntry &l, const TiedStringEntry &r) {
+			          if (l.window != r.window) {
+				          return desc ? l.window > r.window : l.window < r.window;
+			          }
+			          // if one of the strings ends within the window, it is a prefix of the other
+			          return desc ? l.length > r.length : l.length < r.length;
+		          });
+		// strings that are tied on this window and extend past it must be compared on the next window
+		const auto next_offset = range.offset + sizeof(uint64_t);
+		for (idx_t i = range.begin; i < range.end;) {
+			idx_t j = i + 1;
+			while (j < range.end && entries[j].window == entries[i].window && entries[j].length == entries[i].length) {
+				j++;
+			}
+			if (j - i > 1 && entries[i].length > next_offset) {
+				ranges.push_back({i, j, next_offset});
+			}
+			i = j;
+		}
+	}
+}
+
+//! Sorts strings that are tied by their prefix after the radix sort
 static void SortTiedBlobs(BufferManager &buffer_manager, const data_ptr_t dataptr, const idx_t &start, const idx_t &end,
                           const idx_t &tie_col, bool *ties, const data_ptr_t blob_ptr, const SortLayout &sort_layout) {
 	const auto row_width = sort_layout.blob_layout.GetRowWidth();
@@ -23,20 +84,43 @@ static void SortTiedBlobs(BufferManager &buffer_manager, const data_ptr_t datapt
 		entry_ptrs[i - start] = row_ptr;
 		row_ptr += sort_layout.entry_size;
 	}
-	// Slow pointer-based sorting
 	const int order = sort_layout.order_types[tie_col] == OrderType::DESCENDING ? -1 : 1;
 	const idx_t &col_idx = sort_layout.sorting_to_blob_col.at(tie_col);
 	const auto &tie_col_offset = sort_layout.blob_layout.GetOffsets()[col_idx];
 	auto logical_type = sort_layout.blob_layout.GetTypes()[col_idx];
-	std::sort(entry_ptrs, entry_ptrs + end - start,
-	          [&blob_ptr, &order, &sort_layout, &tie_col_offset, &row_width, &logical_type](const data_ptr_t l,
-	                                                                                        const data_ptr_t r) {
-		          idx_t left_idx = Load<uint32_t>(l + sort_layout.comparison_size);
-		          idx_t right_idx = Load<uint32_t>(r + sort_layout.comparison_size);
-		          data_ptr_t left_ptr = blob_ptr + left_idx * row_width + tie_col_offset;
-		          data_ptr_t right_ptr = blob_ptr + right_idx * row_width + tie_col_offset;
-		          return order * Comparators::CompareVal(left_ptr, right_ptr, logical_type) < 0;
-	          });
+	if (logical_type.InternalType() == PhysicalType::VARCHAR) {
+		// Strings are tied on the bytes in the radix sorting key: sort them on the bytes that follow
+		const auto &common_prefix = sort_layout.common_prefixes[tie_col];
+		idx_t compared_bytes = common_prefix.size() + sort_layout.prefix_lengths[tie_col];
+		auto string_block = make_unsafe_uniq_array<TiedStringEntry>(end - start);
+		auto string_entries = string_block.get();
+		for (idx_t i = 0; i < end - start; i++) {
+			const auto idx = Load<uint32_t>(entry_ptrs[i] + sort_layout.comparison_size);
+			auto &str = string_entries[i].str;
+			str = Load<string_t>(blob_ptr + idx * row_width + tie_col_offset);
+			string_entries[i].row_ptr = entry_ptrs[i];
+			if (str.GetSize() < common_prefix.size() ||
+			    memcmp(str.GetData(), common_prefix.data(), common_prefix.size()) != 0) {
+				// The string does not start with the common prefix: none of its bytes were compared
+				compared_bytes = 0;
+			}
+		}
+		SortTiedStrings(string_entries, end - start, compared_bytes, order == -1);
+		for (idx_t i = 0; i < end - start; i++) {
+			entry_ptrs[i] = string_entries[i].row_ptr;
+		}
+	} else {
+		// Slow pointer-based sorting
+		std::sort(entry_ptrs, entry_ptrs + end - start,
+		          [&blob_ptr, &order, &sort_layout, &tie_col_offset, &row_width, &logical_type](const data_ptr_t l,
+		                                                                                        const data_ptr_t r) {
+			          idx_t left_idx = Load<uint32_t>(l + sort_layout.comparison_size);
+			          idx_t right_idx = Load<uint32_t>(r + sort_layout.comparison_size);
+			          data_ptr_t left_ptr = blob_ptr + left_idx * row_width + tie_col_offset;
+			          data_ptr_t right_ptr = blob_ptr + right_idx * row_width + tie_col_offset;
+			          return order * Comparators::CompareVal(left_ptr, right_ptr, logical_type) < 0;
+		          });
+	}
 	// Re-order
 	auto temp_block = buffer_manager.GetBufferAllocator().Allocate((end - start) * sort_layout.entry_size);
 	data_ptr_t temp_ptr = temp_block.get();
@@ -235,10 +319,54 @@ void RadixSortMSD(const data_ptr_t orig_ptr, const data_ptr_t temp_ptr, const id
 	}
 }
 
+//! Checks whether the rows are already ordered on the sorting key (e.g., when the input is clustered on the key)
+//! Rows that are in reverse order are reversed in place. Returns true if the rows are sorted after this
+static bool SortPresorted(const data_ptr_t dataptr, const idx_t &count, const idx_t &col_offset,
+                          const idx_t &row_width, const idx_t &sorting_size) {
+	if (count <= SortConstants::INSERTION_SORT_THRESHOLD) {
+		return false;
+	}
+	// both checks stop at the first pair that is out of order, so unordered input is detected quickly
+	data_ptr_t row_ptr = dataptr + col_offset;
+	idx_t i;
+	for (i = 0; i < count - 1; i++) {
+		if (FastMemcmp(row_ptr, row_ptr + row_width, sorting_size) > 0) {
+			break;
+		}
+		row_ptr += row_width;
+	}
+	if (i == count - 1) {
+		return true;
+	}
+	if (i != 0) {
+		// an ascending run followed by a descent: not sorted in either direction
+		return false;
+	}
+	row_ptr = dataptr + col_offset;
+	for (i = 0; i < count - 1; i++) {
+		if (FastMemcmp(row_ptr, row_ptr + row_width, sorting_size) < 0) {
+			return false;
+		}
+		row_ptr += row_width;
+	}
+	// descending order: reverse the rows
+	auto temp_row = make_unsafe_uniq_array<data_t>(row_width);
+	data_ptr_t l_ptr = dataptr;
+	data_ptr_t r_ptr = dataptr + (count - 1) * row_width;
+	for (; l_ptr < r_ptr; l_ptr += row_width, r_ptr -= row_width) {
+		FastMemcpy(temp_row.get(), l_ptr, row_width);
+		FastMemcpy(l_ptr, r_ptr, row_width);
+		FastMemcpy(r_ptr, temp_row.get(), row_width);
+	}
+	return true;
+}
+
 //! Calls different sort functions, depending on the count and sorting sizes
 void RadixSort(BufferManager &buffer_manager, const data_ptr_t &dataptr, const idx_t &count, const idx_t &col_offset,
                const idx_t &sorting_size, const SortLayout &sort_layout, bool contains_string) {
-	if (contains_string) {
+	if (SortPresorted(dataptr, count, col_offset, sort_layout.entry_size, sorting_size)) {
+		return;
+	} else if (contains_string) {
 		auto begin = duckdb_pdqsort::PDQIterator(dataptr, sort_layout.entry_size);
 		auto end = begin + count;
 		duckdb_pdqsort::PDQConstants constants(sort_layout.entry_size, col_offset, sorting_size, *end);
@@ -42,6 +42,22 @@ idx_t GetNestedSortingColSize(idx_t &col_size, const LogicalType &type) {
 	}
 }
 
+//! Returns the prefix that all strings share according to the statistics
+static string GetCommonStringPrefix(const BaseStatistics &stats) {
+	if (!stats.CanHaveNoNull()) {
+		return string();
+	}
+	// any string lies between the (truncated) min and max, and therefore shares their common prefix
+	// the min and max do not contain zero bytes, so strings are at least as long as the common prefix
+	auto min = StringStats::Min(stats);
+	auto max = StringStats::Max(stats);
+	idx_t common_length = 0;
+	while (common_length < min.size() && common_length < max.size() && min[common_length] == max[common_length]) {
+		common_length++;
+	}
+	return min.substr(0, common_length);
+}
+
 SortLayout::SortLayout(const vector<BoundOrderByNode> &orders)
     : column_count(orders.size()), all_constant(true), comparison_size(0), entry_size(0) {
 	vector<LogicalType> blob_layout_types;
@@ -66,15 +82,22 @@ SortLayout::SortLayout(const vector<BoundOrderByNode> &orders)
 
 		idx_t col_size = has_null.back() ? 1 : 0;
 		prefix_lengths.push_back(0);
+		common_prefixes.emplace_back();
 		if (!TypeIsConstantSize(physical_type) && physical_type != PhysicalType::VARCHAR) {
 			prefix_lengths.back() = GetNestedSortingColSize(col_size, expr.return_type);
 		} else if (physical_type == PhysicalType::VARCHAR) {
 			idx_t size_before = col_size;
+			if (stats.back()) {
+				// skip the prefix that all strings share, so that the radix sorting key covers the bytes that differ
+				common_prefixes.back() = GetCommonStringPrefix(*stats.back());
+			}
 			if (stats.back() && StringStats::HasMaxStringLength(*stats.back())) {
-				col_size += StringStats::MaxStringLength(*stats.back());
+				col_size += StringStats::MaxStringLength(*stats.back()) - common_prefixes.back().size();
 				if (col_size > 12) {
 					col_size = 12;
-				} else {
+				} else if (common_prefixes.back().empty()) {
+					// with a common prefix the strings are kept in the blob: the statistics may be outdated (e.g., when
+					// a prepared statement is re-executed), and strings without the prefix are tied in the radix key
 					constant_size.back() = true;
 				}
 			} else {
@@ -100,13 +123,14 @@ SortLayout::SortLayout(const vector<BoundOrderByNode> &orders)
 			}
 			if (logical_types[col_idx].InternalType() == PhysicalType::VARCHAR && stats[col_idx] &&
 			    StringStats::HasMaxStringLength(*stats[col_idx])) {
-				idx_t diff = StringStats::MaxStringLength(*stats[col_idx]) - prefix_lengths[col_idx];
+				idx_t diff = StringStats::MaxStringLength(*stats[col_idx]) - common_prefixes[col_idx].size() -
+				             prefix_lengths[col_idx];
 				if (diff > 0) {
 					// Increase all sizes accordingly
 					idx_t increase = MinValue(bytes_to_fill, diff);
 					column_sizes[col_idx] += increase;
 					prefix_lengths[col_idx] += increase;
-					constant_size[col_idx] = increase == diff;
+					constant_size[col_idx] = increase == diff && common_prefixes[col_idx].empty();
 					comparison_size += increase;
 					entry_size += increase;
 					bytes_to_fill -= increase;
@@ -144,6 +168,7 @@ SortLayout SortLayout::GetPrefixComparisonLayout(idx_t num_prefix_cols) const {
 		result.column_sizes.push_back(column_sizes[col_idx]);
 
 		result.prefix_lengths.push_back(prefix_lengths[col_idx]);
+		result.common_prefixes.push_back(common_prefixes[col_idx]);
 		result.stats.push_back(stats[col_idx]);
 		result.has_null.push_back(has_null[col_idx]);
 	}
@@ -193,7 +218,7 @@ void LocalSortState::SinkChunk(DataChunk &sort, DataChunk &payload) {
 		bool desc = sort_layout->order_types[sort_col] == OrderType::DESCENDING;
 		RowOperations::RadixScatter(sort.data[sort_col], sort.size(), sel_ptr, sort.size(), data_pointers, desc,
 		                            has_null, nulls_first, sort_layout->prefix_lengths[sort_col],
-		                            sort_layout->column_sizes[sort_col]);
+		                            sort_layout->column_sizes[sort_col], 0, sort_layout->common_prefixes[sort_col]);
 	}
 
 	// Also fully serialize blob sorting columns (to be able to break ties
@@ -1,6 +1,7 @@
 #include "duckdb/execution/join_hashtable.hpp"
 
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/prefetch.hpp"
 #include "duckdb/common/row_operations/row_operations.hpp"
 #include "duckdb/common/types/column/column_data_collection_segment.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
@@ -18,7 +19,8 @@ JoinHashTable::JoinHashTable(BufferManager &buffer_manager_p, const vector<JoinC
                              vector<LogicalType> btypes, JoinType type_p, const vector<idx_t> &output_columns_p)
     : buffer_manager(buffer_manager_p), conditions(conditions_p), build_types(std::move(btypes)),
       output_columns(output_columns_p), entry_size(0), tuple_size(0), vfound(Value::BOOLEAN(false)), join_type(type_p),
-      finalized(false), has_null(false), radix_bits(INITIAL_RADIX_BITS), partition_start(0), partition_end(0) {
+      finalized(false), has_null(false), prefetch_probe(false), pointer_table_partition_start(0),
+      radix_bits(INITIAL_RADIX_BITS), partition_start(0), partition_end(0) {
 
 	for (auto &condition : conditions) {
 		D_ASSERT(condition.left->return_type == condition.right->return_type);
@@ -86,32 +88,86 @@ void JoinHashTable::Merge(JoinHashTable &other) {
 	sink_collection->Combine(*other.sink_collection);
 }
 
-void JoinHashTable::ApplyBitmask(Vector &hashes, idx_t count) {
-	if (hashes.GetVectorType() == VectorType::CONSTANT_VECTOR) {
-		D_ASSERT(!ConstantVector::IsNull(hashes));
-		auto indices = ConstantVector::GetData<hash_t>(hashes);
-		*indices = *indices & bitmask;
-	} else {
-		hashes.Flatten(count);
-		auto indices = FlatVector::GetData<hash_t>(hashes);
-		for (idx_t i = 0; i < count; i++) {
-			indices[i] &= bitmask;
+static inline void IncrementAndWrap(idx_t &value, const uint64_t &bitmask) {
+	value++;
+	value &= bitmask;
+}
+
+//! Routes hashes to the pointer table partition that holds them, using the radix bits of the hash
+struct PointerTablePartitionLookup {
+	PointerTablePartitionLookup(const vector<JoinHashTable::PointerTablePartition> &partitions_p, idx_t radix_bits,
+	                            idx_t partition_start_p)
+	    : partitions(partitions_p.data()), mask(RadixPartitioning::Mask(radix_bits)),
+	      shift(RadixPartitioning::Shift(radix_bits)), partition_start(partition_start_p) {
+	}
+
+	inline const JoinHashTable::PointerTablePartition &GetPartition(const hash_t &hash) const {
+		return partitions[((hash & mask) >> shift) - partition_start];
+	}
+
+	const JoinHashTable::PointerTablePartition *partitions;
+	const hash_t mask;
+	const idx_t shift;
+	const idx_t partition_start;
+};
+
+template <bool PREFETCH>
+static inline void GetRowPointersInternal(const ht_entry_t entries[], const PointerTablePartitionLookup &lookup,
+                                          const hash_t hash_data[], const SelectionVector &hash_sel,
+                                          const SelectionVector &sel, idx_t count, data_ptr_t result_data[]) {
+	// first compute the offsets into the pointer table for the whole vector
+	// when prefetching, this allows us to have the entries of the entire vector in flight at the same time
+	hash_t ht_offsets[STANDARD_VECTOR_SIZE];
+	for (idx_t i = 0; i < count; i++) {
+		const auto hash = hash_data[hash_sel.get_index(sel.get_index(i))];
+		const auto &partition = lookup.GetPartition(hash);
+		ht_offsets[i] = hash & partition.bitmask;
+		if (PREFETCH) {
+			DUCKDB_PREFETCH(entries + partition.ht_offset + ht_offsets[i]);
+		}
+	}
+
+	for (idx_t i = 0; i < count; i++) {
+		const auto rindex = sel.get_index(i);
+		const auto hash = hash_data[hash_sel.get_index(rindex)];
+		const auto salt = ht_entry_t::ExtractSalt(hash);
+		const auto &partition = lookup.GetPartition(hash);
+		const auto partition_entries = entries + partition.ht_offset;
+
+		// linear probing until we find an empty entry (no match) or an entry with the same salt (potential match)
+		// the salt check filters out most collisions without having to follow the pointer into the row data
+		auto &ht_offset = ht_offsets[i];
+		while (true) {
+			const auto &entry = partition_entries[ht_offset];
+			if (!entry.IsOccupied()) {
+				result_data[rindex] = nullptr;
+				break;
+			}
+			if (entry.GetSalt() == salt) {
+				result_data[rindex] = entry.GetPointer();
+				if (PREFETCH) {
+					// the keys of this row are compared next
+					DUCKDB_PREFETCH(result_data[rindex]);
+				}
+				break;
+			}
+			IncrementAndWrap(ht_offset, partition.bitmask);
 		}
 	}
 }
 
-void JoinHashTable::ApplyBitmask(Vector &hashes, const SelectionVector &sel, idx_t count, Vector &pointers) {
+void JoinHashTable::GetRowPointers(Vector &hashes, const SelectionVector &sel, idx_t count, Vector &pointers) {
 	UnifiedVectorFormat hdata;
 	hashes.ToUnifiedFormat(count, hdata);
 
 	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
-	auto result_data = FlatVector::GetData<data_ptr_t *>(pointers);
-	auto main_ht = reinterpret_cast<data_ptr_t *>(hash_map.get());
-	for (idx_t i = 0; i < count; i++) {
-		auto rindex = sel.get_index(i);
-		auto hindex = hdata.sel->get_index(rindex);
-		auto hash = hash_data[hindex];
-		result_data[rindex] = main_ht + (hash & bitmask);
+	auto result_data = FlatVector::GetData<data_ptr_t>(pointers);
+	auto entries = reinterpret_cast<const ht_entry_t *>(hash_map.get());
+	PointerTablePartitionLookup lookup(pointer_table_partitions, radix_bits, pointer_table_partition_start);
+	if (prefetch_probe) {
+		GetRowPointersInternal<true>(entries, lookup, hash_data, *hdata.sel, sel, count, result_data);
+	} else {
+		GetRowPointersInternal<false>(entries, lookup, hash_data, *hdata.sel, sel, count, result_data);
 	}
 }
 
@@ -244,66 +300,145 @@ idx_t JoinHashTable::PrepareKeys(DataChunk &keys, vector<TupleDataVectorFormat>
 }
 
 template <bool PARALLEL>
-static inline void InsertHashesLoop(atomic<data_ptr_t> pointers[], const hash_t indices[], const idx_t count,
-                                    const data_ptr_t key_locations[], const idx_t pointer_offset) {
+static inline void InsertHashesLoop(atomic<ht_entry_t> entries[], const PointerTablePartitionLookup &lookup,
+                                    const hash_t hashes[], const idx_t count, const data_ptr_t key_locations[],
+                                    const idx_t pointer_offset) {
 	for (idx_t i = 0; i < count; i++) {
-		const auto index = indices[i];
-		if (PARALLEL) {
-			data_ptr_t head;
-			do {
-				head = pointers[index];
-				Store<data_ptr_t>(head, key_locations[i] + pointer_offset);
-			} while (!std::atomic_compare_exchange_weak(&pointers[index], &head, key_locations[i]));
-		} else {
-			// set prev in current key to the value (NOTE: this will be nullptr if there is none)
-			Store<data_ptr_t>(pointers[index], key_locations[i] + pointer_offset);
-
-			// set pointer to current tuple
-			pointers[index] = key_locations[i];
+		const auto salt = ht_entry_t::ExtractSalt(hashes[i]);
+		const auto &row_location = key_locations[i];
+		const auto &partition = lookup.GetPartition(hashes[i]);
+		const auto partition_entries = entries + partition.ht_offset;
+
+		// linear probing until we find an empty entry or an entry with the same salt
+		idx_t ht_offset = hashes[i] & partition.bitmask;
+		while (true) {
+			auto &entry = partition_entries[ht_offset];
+			auto current_entry = entry.load(std::memory_order_relaxed);
+			if (current_entry.IsOccupied() && current_entry.GetSalt() != salt) {
+				IncrementAndWrap(ht_offset, partition.bitmask);
+				continue;
+			}
+			// prepend the row to the chain of the entry (NOTE: the chain is empty if the entry is not occupied)
+			Store<data_ptr_t>(current_entry.IsOccupied() ? current_entry.GetPointer() : nullptr,
+			                  row_location + pointer_offset);
+			const ht_entry_t desired_entry(salt, row_location);
+			if (!PARALLEL) {
+				entry.store(desired_entry, std::memory_order_relaxed);
+				break;
+			}
+			if (std::atomic_compare_exchange_weak(&entry, &current_entry, desired_entry)) {
+				break;
+			}
+			// another thread modified the entry in the meantime: try this entry again
 		}
 	}
 }
 
 void JoinHashTable::InsertHashes(Vector &hashes, idx_t count, data_ptr_t key_locations[], bool parallel) {
 	D_ASSERT(hashes.GetType().id() == LogicalType::HASH);
-
-	// use bitmask to get position in array
-	ApplyBitmask(hashes, count);
-
 	hashes.Flatten(count);
 	D_ASSERT(hashes.GetVectorType() == VectorType::FLAT_VECTOR);
 
-	auto pointers = reinterpret_cast<atomic<data_ptr_t> *>(hash_map.get());
-	auto indices = FlatVector::GetData<hash_t>(hashes);
+	auto entries = reinterpret_cast<atomic<ht_entry_t> *>(hash_map.get());
+	auto hash_data = FlatVector::GetData<hash_t>(hashes);
+	PointerTablePartitionLookup lookup(pointer_table_partitions, radix_bits, pointer_table_partition_start);
 
 	if (parallel) {
-		InsertHashesLoop<true>(pointers, indices, count, key_locations, pointer_offset);
+		InsertHashesLoop<true>(entries, lookup, hash_data, count, key_locations, pointer_offset);
 	} else {
-		InsertHashesLoop<false>(pointers, indices, count, key_locations, pointer_offset);
+		InsertHashesLoop<false>(entries, lookup, hash_data, count, key_locations, pointer_offset);
+	}
+}
+
+void JoinHashTable::InitializePointerTablePartitions(idx_t partition_idx_from, idx_t partition_idx_to) {
+	auto &partitions = sink_collection->GetPartitions();
+	pointer_table_partitions.clear();
+	pointer_table_partition_start = partition_idx_from;
+
+	// the partitions are moved to the (empty) data_collection in order, so each covers a consecutive range of chunks
+	D_ASSERT(data_collection->ChunkCount() == 0);
+	idx_t chunk_idx = 0;
+	for (idx_t partition_idx = partition_idx_from; partition_idx < partition_idx_to; partition_idx++) {
+		auto &partition = *partitions[partition_idx];
+		PointerTablePartition pointer_table_partition;
+		pointer_table_partition.count = partition.Count();
+		pointer_table_partition.chunk_idx_from = chunk_idx;
+		chunk_idx += partition.ChunkCount();
+		pointer_table_partition.chunk_idx_to = chunk_idx;
+		pointer_table_partition.ht_offset = 0;
+		pointer_table_partition.bitmask = 0;
+		pointer_table_partitions.push_back(pointer_table_partition);
 	}
 }
 
 void JoinHashTable::InitializePointerTable() {
-	idx_t capacity = PointerTableCapacity(Count());
-	D_ASSERT(IsPowerOfTwo(capacity));
+	D_ASSERT(!pointer_table_partitions.empty());
+
+	// every partition gets its own part of the pointer table, with a capacity of (at least) twice its count
+	const auto minimum_partition_capacity = PointerTableCapacity(Count()) / pointer_table_partitions.size();
+	idx_t capacity = 0;
+	for (auto &partition : pointer_table_partitions) {
+		const auto partition_capacity =
+		    MaxValue<idx_t>(NextPowerOfTwo(MaxValue<idx_t>(partition.count * 2, minimum_partition_capacity)), 1);
+		D_ASSERT(IsPowerOfTwo(partition_capacity));
+		partition.ht_offset = capacity;
+		partition.bitmask = partition_capacity - 1;
+		capacity += partition_capacity;
+	}
 
 	if (hash_map.get()) {
 		// There is already a hash map
-		auto current_capacity = hash_map.GetSize() / sizeof(data_ptr_t);
+		auto current_capacity = hash_map.GetSize() / sizeof(ht_entry_t);
 		if (capacity != current_capacity) {
 			// Different size, re-allocate
-			hash_map = buffer_manager.GetBufferAllocator().Allocate(capacity * sizeof(data_ptr_t));
+			hash_map = buffer_manager.GetBufferAllocator().Allocate(capacity * sizeof(ht_entry_t));
 		}
 	} else {
 		// Allocate a hash map
-		hash_map = buffer_manager.GetBufferAllocator().Allocate(capacity * sizeof(data_ptr_t));
+		hash_map = buffer_manager.GetBufferAllocator().Allocate(capacity * sizeof(ht_entry_t));
 	}
-	D_ASSERT(hash_map.GetSize() == capacity * sizeof(data_ptr_t));
+	D_ASSERT(hash_map.GetSize() == capacity * sizeof(ht_entry_t));
 
 	// initialize HT with all-zero entries
-	std::fill_n(reinterpret_cast<data_ptr_t *>(hash_map.get()), capacity, nullptr);
+	std::fill_n(reinterpret_cast<ht_entry_t *>(hash_map.get()), capacity, ht_entry_t());
 
-	bitmask = capacity - 1;
+	// if the HT does not fit in the CPU caches, probing is bound by memory latency: prefetch while probing
+	prefetch_probe = data_collection->SizeInBytes() + hash_map.GetSize() > PREFETCH_THRESHOLD;
+}
+
+vector<JoinHashTable::PointerTableBuildRange> JoinHashTable::GetPointerTableBuildRanges(idx_t num_threads) const {
+	vector<PointerTableBuildRange> result;
+	const auto chunk_count = data_collection->ChunkCount();
+	if (num_threads <= 1) {
+		result.push_back({0, chunk_count, false});
+		return result;
+	}
+
+	// Threads insert whole partitions, so they do not need atomics as they write to separate parts of the pointer
+	// table. Partitions that are too large for a single thread are split, and the threads sharing them use atomics
+	const auto chunks_per_range = MaxValue<idx_t>((chunk_count + num_threads - 1) / num_threads, 1);
+	idx_t range_start = 0;
+	for (auto &partition : pointer_table_partitions) {
+		if (partition.chunk_idx_to - partition.chunk_idx_from > chunks_per_range) {
+			if (range_start != partition.chunk_idx_from) {
+				result.push_back({range_start, partition.chunk_idx_from, false});
+			}
+			for (idx_t chunk_idx = partition.chunk_idx_from; chunk_idx < partition.chunk_idx_to;
+			     chunk_idx += chunks_per_range) {
+				result.push_back(
+				    {chunk_idx, MinValue<idx_t>(chunk_idx + chunks_per_range, partition.chunk_idx_to), true});
+			}
+			range_start = partition.chunk_idx_to;
+		} else if (partition.chunk_idx_to - range_start > chunks_per_range) {
+			// this partition does not fit in the current range anymore: start a new range
+			result.push_back({range_start, partition.chunk_idx_from, false});
+			range_start = partition.chunk_idx_from;
+		}
+	}
+	if (range_start != chunk_count) {
+		result.push_back({range_start, chunk_count, false});
+	}
+	return result;
 }
 
 void JoinHashTable::Finalize(idx_t chunk_idx_from, idx_t chunk_idx_to, bool parallel) {
@@ -353,14 +488,14 @@ unique_ptr<ScanStructure> JoinHashTable::Probe(DataChunk &keys, TupleDataChunkSt
 	}
 
 	if (precomputed_hashes) {
-		ApplyBitmask(*precomputed_hashes, *current_sel, ss->count, ss->pointers);
+		GetRowPointers(*precomputed_hashes, *current_sel, ss->count, ss->pointers);
 	} else {
 		// hash all the keys
 		Vector hashes(LogicalType::HASH);
 		Hash(keys, *current_sel, ss->count, hashes);
 
 		// now initialize the pointers of the scan structure based on the hashes
-		ApplyBitmask(hashes, *current_sel, ss->count, ss->pointers);
+		GetRowPointers(hashes, *current_sel, ss->count, ss->pointers);
 	}
 
 	// create the selection vector linking to only non-empty entries
@@ -371,7 +506,7 @@ unique_ptr<ScanStructure> JoinHashTable::Probe(DataChunk &keys, TupleDataChunkSt
 
 ScanStructure::ScanStructure(JoinHashTable &ht_p, TupleDataChunkState &key_state_p)
     : key_state(key_state_p), pointers(LogicalType::POINTER), sel_vector(STANDARD_VECTOR_SIZE), ht(ht_p),
-      finished(false) {
+      finished(false), scan_chains(false) {
 }
 
 void ScanStructure::Next(DataChunk &keys, DataChunk &left, DataChunk &result) {
@@ -456,6 +591,9 @@ void ScanStructure::AdvancePointers(const SelectionVector &sel, idx_t sel_count)
 		auto idx = sel.get_index(i);
 		ptrs[idx] = Load<data_ptr_t>(ptrs[idx] + ht.pointer_offset);
 		if (ptrs[idx]) {
+			if (ht.prefetch_probe) {
+				DUCKDB_PREFETCH(ptrs[idx]);
+			}
 			this->sel_vector.set_index(new_count++, idx);
 		}
 	}
@@ -468,7 +606,6 @@ void ScanStructure::InitializeSelectionVector(const SelectionVector *&current_se
 	auto cnt = count;
 	for (idx_t i = 0; i < cnt; i++) {
 		const auto idx = current_sel->get_index(i);
-		ptrs[idx] = Load<data_ptr_t>(ptrs[idx]);
 		if (ptrs[idx]) {
 			sel_vector.set_index(non_empty_count++, idx);
 		}
@@ -499,6 +636,11 @@ void ScanStructure::NextInnerJoin(DataChunk &keys, DataChunk &left, DataChunk &r
 		return;
 	}
 
+	if (scan_chains) {
+		NextInnerJoinChains(keys, left, result);
+		return;
+	}
+
 	SelectionVector result_vector(STANDARD_VECTOR_SIZE);
 
 	idx_t result_count = ScanInnerJoin(keys, result_vector);
@@ -529,6 +671,90 @@ void ScanStructure::NextInnerJoin(DataChunk &keys, DataChunk &left, DataChunk &r
 			}
 		}
 		AdvancePointers();
+		if (this->count != 0 && this->count < CHAIN_SCAN_THRESHOLD) {
+			// only a few probe rows have matches left, but their chains are long (e.g., heavy hitter keys)
+			// following the chains one step per call would produce tiny result chunks: scan the chains instead
+			scan_chains = true;
+		}
+	}
+}
+
+ScanStructure::ChainScanState::ChainScanState(const vector<LogicalType> &key_types)
+    : pointers(LogicalType::POINTER), chain_sel(STANDARD_VECTOR_SIZE), match_sel(STANDARD_VECTOR_SIZE),
+      result_sel(STANDARD_VECTOR_SIZE) {
+	keys.InitializeEmpty(key_types);
+	TupleDataCollection::InitializeChunkState(key_state, key_types);
+}
+
+void ScanStructure::NextInnerJoinChains(DataChunk &keys, DataChunk &left, DataChunk &result) {
+	if (!chain_state) {
+		chain_state = make_uniq<ChainScanState>(keys.GetTypes());
+	}
+	auto &chain_pointers = chain_state->pointers;
+	auto &chain_sel = chain_state->chain_sel;
+	auto &match_sel = chain_state->match_sel;
+	auto &chain_keys = chain_state->keys;
+	auto &chain_key_state = chain_state->key_state;
+
+	auto ptrs = FlatVector::GetData<data_ptr_t>(pointers);
+	auto chain_ptrs = FlatVector::GetData<data_ptr_t>(chain_pointers);
+
+	idx_t match_count = 0;
+	while (match_count == 0 && this->count != 0) {
+		// collect the entries of the chains of the remaining probe rows, until we have a full chunk
+		idx_t chain_count = 0;
+		idx_t new_count = 0;
+		for (idx_t i = 0; i < this->count; i++) {
+			const auto idx = sel_vector.get_index(i);
+			auto ptr = ptrs[idx];
+			for (; ptr && chain_count < STANDARD_VECTOR_SIZE; ptr = Load<data_ptr_t>(ptr + ht.pointer_offset)) {
+				chain_sel.set_index(chain_count, idx);
+				chain_ptrs[chain_count++] = ptr;
+			}
+			ptrs[idx] = ptr;
+			if (ptr) {
+				sel_vector.set_index(new_count++, idx);
+			}
+		}
+		this->count = new_count;
+
+		// now compare the keys of all collected entries at once
+		chain_keys.Slice(keys, chain_sel, chain_count);
+		TupleDataCollection::ToUnifiedFormat(chain_key_state, chain_keys);
+		for (idx_t i = 0; i < chain_count; i++) {
+			match_sel.set_index(i, i);
+		}
+		idx_t no_match_count = 0;
+		match_count = ht.row_matcher.Match(chain_keys, chain_key_state.vector_data, match_sel, chain_count, ht.layout,
+		                                   chain_pointers, nullptr, no_match_count);
+	}
+	if (match_count == 0) {
+		return;
+	}
+
+	auto &result_vector = chain_state->result_sel;
+	for (idx_t i = 0; i < match_count; i++) {
+		const auto chain_idx = match_sel.get_index(i);
+		const auto idx = chain_sel.get_index(chain_idx);
+		result_vector.set_index(i, idx);
+		if (found_match) {
+			found_match[idx] = true;
+		}
+		if (PropagatesBuildSide(ht.join_type)) {
+			// full/right outer join: mark join matches as FOUND in the HT
+			Store<bool>(true, chain_ptrs[chain_idx] + ht.tuple_size);
+		}
+	}
+
+	if (ht.join_type != JoinType::RIGHT_SEMI && ht.join_type != JoinType::RIGHT_ANTI) {
+		result.Slice(left, result_vector, match_count);
+		for (idx_t i = 0; i < ht.output_columns.size(); i++) {
+			auto &vector = result.data[left.ColumnCount() + i];
+			const auto output_col_idx = ht.output_columns[i];
+			D_ASSERT(vector.GetType() == ht.layout.GetTypes()[output_col_idx]);
+			ht.data_collection->Gather(chain_pointers, match_sel, match_count, output_col_idx, vector,
+			                           *FlatVector::IncrementalSelectionVector(), nullptr);
+		}
 	}
 }
 
@@ -926,6 +1152,7 @@ idx_t JoinHashTable::GetRemainingSize() {
 }
 
 void JoinHashTable::Unpartition() {
+	InitializePointerTablePartitions(0, sink_collection->GetPartitions().size());
 	data_collection = sink_collection->GetUnpartitioned();
 }
 
@@ -995,6 +1222,7 @@ bool JoinHashTable::PrepareExternalFinalize(const idx_t max_ht_size) {
 		data_size = incl_data_size;
 	}
 	partition_end = partition_idx;
+	InitializePointerTablePartitions(partition_start, partition_end);
 
 	// Move the partitions to the main data collection
 	for (partition_idx = partition_start; partition_idx < partition_end; partition_idx++) {
@@ -1055,7 +1283,7 @@ unique_ptr<ScanStructure> JoinHashTable::ProbeAndSpill(DataChunk &keys, TupleDat
 	}
 
 	// now initialize the pointers of the scan structure based on the hashes
-	ApplyBitmask(hashes, *current_sel, ss->count, ss->pointers);
+	GetRowPointers(hashes, *current_sel, ss->count, ss->pointers);
 
 	// create the selection vector linking to only non-empty entries
 	ss->InitializeSelectionVector(current_sel);
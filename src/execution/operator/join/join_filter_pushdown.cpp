@@ -0,0 +1,151 @@
+#include "duckdb/execution/operator/join/join_filter_pushdown.hpp"
+
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/storage/statistics/numeric_stats.hpp"
+
+namespace duckdb {
+
+bool JoinFilterPushdownInfo::SupportsType(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::HUGEINT:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::UBIGINT:
+	case LogicalTypeId::UHUGEINT:
+	case LogicalTypeId::DECIMAL:
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::TIME:
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_SEC:
+	case LogicalTypeId::TIMESTAMP_MS:
+	case LogicalTypeId::TIMESTAMP_NS:
+	case LogicalTypeId::TIMESTAMP_TZ:
+		return true;
+	default:
+		return false;
+	}
+}
+
+static vector<unique_ptr<BaseStatistics>> InitializeKeyStats(const vector<JoinFilterPushdownColumn> &filters,
+                                                            const vector<LogicalType> &condition_types) {
+	vector<unique_ptr<BaseStatistics>> result;
+	for (auto &filter : filters) {
+		result.push_back(NumericStats::CreateEmpty(condition_types[filter.join_condition]).ToUnique());
+	}
+	return result;
+}
+
+unique_ptr<JoinFilterGlobalState> JoinFilterPushdownInfo::GetGlobalState(const vector<LogicalType> &condition_types) const {
+	auto result = make_uniq<JoinFilterGlobalState>();
+	result->key_stats = InitializeKeyStats(filters, condition_types);
+	return result;
+}
+
+unique_ptr<JoinFilterLocalState> JoinFilterPushdownInfo::GetLocalState(const vector<LogicalType> &condition_types) const {
+	auto result = make_uniq<JoinFilterLocalState>();
+	result->key_stats = InitializeKeyStats(filters, condition_types);
+	return result;
+}
+
+template <class T>
+static void TemplatedUpdateKeyStats(BaseStatistics &stats, Vector &keys, idx_t count) {
+	UnifiedVectorFormat vdata;
+	keys.ToUnifiedFormat(count, vdata);
+	auto data = UnifiedVectorFormat::GetData<T>(vdata);
+
+	bool has_no_null = false;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(idx)) {
+			continue;
+		}
+		NumericStats::Update<T>(stats, data[idx]);
+		has_no_null = true;
+	}
+	if (has_no_null) {
+		stats.SetHasNoNull();
+	}
+}
+
+static void UpdateKeyStats(BaseStatistics &stats, Vector &keys, idx_t count) {
+	switch (keys.GetType().InternalType()) {
+	case PhysicalType::INT8:
+		TemplatedUpdateKeyStats<int8_t>(stats, keys, count);
+		break;
+	case PhysicalType::INT16:
+		TemplatedUpdateKeyStats<int16_t>(stats, keys, count);
+		break;
+	case PhysicalType::INT32:
+		TemplatedUpdateKeyStats<int32_t>(stats, keys, count);
+		break;
+	case PhysicalType::INT64:
+		TemplatedUpdateKeyStats<int64_t>(stats, keys, count);
+		break;
+	case PhysicalType::INT128:
+		TemplatedUpdateKeyStats<hugeint_t>(stats, keys, count);
+		break;
+	case PhysicalType::UINT8:
+		TemplatedUpdateKeyStats<uint8_t>(stats, keys, count);
+		break;
+	case PhysicalType::UINT16:
+		TemplatedUpdateKeyStats<uint16_t>(stats, keys, count);
+		break;
+	case PhysicalType::UINT32:
+		TemplatedUpdateKeyStats<uint32_t>(stats, keys, count);
+		break;
+	case PhysicalType::UINT64:
+		TemplatedUpdateKeyStats<uint64_t>(stats, keys, count);
+		break;
+	case PhysicalType::UINT128:
+		TemplatedUpdateKeyStats<uhugeint_t>(stats, keys, count);
+		break;
+	default:
+		throw InternalException("Unsupported type for join filter pushdown");
+	}
+}
+
+void JoinFilterPushdownInfo::Sink(DataChunk &keys, JoinFilterLocalState &lstate) const {
+	for (idx_t filter_idx = 0; filter_idx < filters.size(); filter_idx++) {
+		auto &key_vector = keys.data[filters[filter_idx].join_condition];
+		UpdateKeyStats(*lstate.key_stats[filter_idx], key_vector, keys.size());
+	}
+}
+
+void JoinFilterPushdownInfo::Combine(JoinFilterGlobalState &gstate, JoinFilterLocalState &lstate) const {
+	lock_guard<mutex> guard(gstate.lock);
+	for (idx_t filter_idx = 0; filter_idx < filters.size(); filter_idx++) {
+		gstate.key_stats[filter_idx]->Merge(*lstate.key_stats[filter_idx]);
+	}
+}
+
+void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const PhysicalOperator &op) const {
+	// clear any filters we pushed previously (e.g. in a previous iteration of a recursive CTE)
+	dynamic_filters->ClearFilters(op);
+	for (idx_t filter_idx = 0; filter_idx < filters.size(); filter_idx++) {
+		auto &stats = *gstate.key_stats[filter_idx];
+		if (!stats.CanHaveNoNull() || !NumericStats::HasMinMax(stats)) {
+			// there are no non-NULL keys on the build side: nothing to push
+			continue;
+		}
+		auto min_val = NumericStats::Min(stats);
+		auto max_val = NumericStats::Max(stats);
+		auto column_index = filters[filter_idx].probe_column_index;
+		if (min_val == max_val) {
+			// a single key: push an equality filter
+			dynamic_filters->PushFilter(op, column_index,
+			                            make_uniq<ConstantFilter>(ExpressionType::COMPARE_EQUAL, std::move(min_val)));
+			continue;
+		}
+		dynamic_filters->PushFilter(
+		    op, column_index, make_uniq<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO, std::move(min_val)));
+		dynamic_filters->PushFilter(
+		    op, column_index, make_uniq<ConstantFilter>(ExpressionType::COMPARE_LESSTHANOREQUALTO, std::move(max_val)));
+	}
+}
+
+} // namespace duckdb
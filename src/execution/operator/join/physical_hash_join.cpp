@@ -103,6 +103,10 @@ public:
 		probe_types.insert(probe_types.end(), op.condition_types.begin(), op.condition_types.end());
 		probe_types.insert(probe_types.end(), payload_types.begin(), payload_types.end());
 		probe_types.emplace_back(LogicalType::HASH);
+
+		if (op.filter_pushdown) {
+			global_filter_state = op.filter_pushdown->GetGlobalState(op.condition_types);
+		}
 	}
 
 	void ScheduleFinalize(Pipeline &pipeline, Event &event);
@@ -136,6 +140,9 @@ public:
 
 	//! Whether or not we have started scanning data using GetData
 	atomic<bool> scanned_data;
+
+	//! The global state for pushing build-side key ranges into the probe side
+	unique_ptr<JoinFilterGlobalState> global_filter_state;
 };
 
 class HashJoinLocalSinkState : public LocalSinkState {
@@ -155,6 +162,10 @@ public:
 
 		hash_table = op.InitializeHashTable(context);
 		hash_table->GetSinkCollection().InitializeAppendState(append_state);
+
+		if (op.filter_pushdown) {
+			local_filter_state = op.filter_pushdown->GetLocalState(op.condition_types);
+		}
 	}
 
 public:
@@ -171,6 +182,9 @@ public:
 	//! For updating the temporary memory state
 	idx_t chunk_count;
 	static constexpr const idx_t CHUNK_COUNT_UPDATE_INTERVAL = 60;
+
+	//! The local state for pushing build-side key ranges into the probe side
+	unique_ptr<JoinFilterLocalState> local_filter_state;
 };
 
 unique_ptr<JoinHashTable> PhysicalHashJoin::InitializeHashTable(ClientContext &context) const {
@@ -239,6 +253,10 @@ SinkResultType PhysicalHashJoin::Sink(ExecutionContext &context, DataChunk &chun
 	lstate.join_keys.Reset();
 	lstate.join_key_executor.Execute(chunk, lstate.join_keys);
 
+	if (filter_pushdown) {
+		filter_pushdown->Sink(lstate.join_keys, *lstate.local_filter_state);
+	}
+
 	// build the HT
 	auto &ht = *lstate.hash_table;
 	if (payload_types.empty()) {
@@ -275,6 +293,9 @@ SinkCombineResultType PhysicalHashJoin::Combine(ExecutionContext &context, Opera
 		lock_guard<mutex> local_ht_lock(gstate.lock);
 		gstate.local_hash_tables.push_back(std::move(lstate.hash_table));
 	}
+	if (filter_pushdown) {
+		filter_pushdown->Combine(*gstate.global_filter_state, *lstate.local_filter_state);
+	}
 	auto &client_profiler = QueryProfiler::Get(context.client);
 	context.thread.profiler.Flush(*this, lstate.join_key_executor, "join_key_executor", 1);
 	client_profiler.Flush(context.thread.profiler);
@@ -320,27 +341,16 @@ public:
 
 		vector<shared_ptr<Task>> finalize_tasks;
 		auto &ht = *sink.hash_table;
-		const auto chunk_count = ht.GetDataCollection().ChunkCount();
-		const auto num_threads = NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
-		if (num_threads == 1 || (ht.Count() < PARALLEL_CONSTRUCT_THRESHOLD && !context.config.verify_parallelism)) {
+		auto num_threads = NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
+		if (ht.Count() < PARALLEL_CONSTRUCT_THRESHOLD && !context.config.verify_parallelism) {
 			// Single-threaded finalize
-			finalize_tasks.push_back(
-			    make_uniq<HashJoinFinalizeTask>(shared_from_this(), context, sink, 0U, chunk_count, false));
-		} else {
-			// Parallel finalize
-			auto chunks_per_thread = MaxValue<idx_t>((chunk_count + num_threads - 1) / num_threads, 1);
-
-			idx_t chunk_idx = 0;
-			for (idx_t thread_idx = 0; thread_idx < num_threads; thread_idx++) {
-				auto chunk_idx_from = chunk_idx;
-				auto chunk_idx_to = MinValue<idx_t>(chunk_idx_from + chunks_per_thread, chunk_count);
-				finalize_tasks.push_back(make_uniq<HashJoinFinalizeTask>(shared_from_this(), context, sink,
-				                                                         chunk_idx_from, chunk_idx_to, true));
-				chunk_idx = chunk_idx_to;
-				if (chunk_idx == chunk_count) {
-					break;
-				}
-			}
+			num_threads = 1;
+		}
+		// Parallel finalize: the threads build separate partitions of the pointer table where possible
+		for (auto &range : ht.GetPointerTableBuildRanges(num_threads)) {
+			finalize_tasks.push_back(make_uniq<HashJoinFinalizeTask>(shared_from_this(), context, sink,
+			                                                         range.chunk_idx_from, range.chunk_idx_to,
+			                                                         range.parallel));
 		}
 		SetTasks(std::move(finalize_tasks));
 	}
@@ -460,6 +470,11 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 	auto &sink = input.global_state.Cast<HashJoinGlobalSinkState>();
 	auto &ht = *sink.hash_table;
 
+	if (filter_pushdown) {
+		// the build side is complete: push the key ranges into the probe-side scan before it is initialized
+		filter_pushdown->PushFilters(*sink.global_filter_state, *this);
+	}
+
 	idx_t max_partition_size;
 	idx_t max_partition_count;
 	auto const total_size = ht.GetTotalSize(sink.local_hash_tables, max_partition_size, max_partition_count);
@@ -664,10 +679,10 @@ public:
 	mutex lock;
 
 	//! For HT build synchronization
-	idx_t build_chunk_idx;
+	vector<JoinHashTable::PointerTableBuildRange> build_ranges;
+	idx_t build_range_idx;
 	idx_t build_chunk_count;
 	idx_t build_chunk_done;
-	idx_t build_chunks_per_thread;
 
 	//! For probe synchronization
 	atomic<idx_t> probe_chunk_count;
@@ -706,8 +721,7 @@ public:
 	Vector addresses;
 
 	//! Chunks assigned to this thread for building the pointer table
-	idx_t build_chunk_idx_from;
-	idx_t build_chunk_idx_to;
+	JoinHashTable::PointerTableBuildRange build_range;
 
 	//! Local scan state for probe spill
 	ColumnDataConsumerScanState probe_local_scan;
@@ -739,8 +753,8 @@ unique_ptr<LocalSourceState> PhysicalHashJoin::GetLocalSourceState(ExecutionCont
 }
 
 HashJoinGlobalSourceState::HashJoinGlobalSourceState(const PhysicalHashJoin &op, ClientContext &context)
-    : op(op), global_stage(HashJoinSourceStage::INIT), build_chunk_count(0), build_chunk_done(0), probe_chunk_count(0),
-      probe_chunk_done(0), probe_count(op.children[0]->estimated_cardinality),
+    : op(op), global_stage(HashJoinSourceStage::INIT), build_range_idx(0), build_chunk_count(0), build_chunk_done(0),
+      probe_chunk_count(0), probe_chunk_done(0), probe_count(op.children[0]->estimated_cardinality),
       parallel_scan_chunk_count(context.config.verify_parallelism ? 1 : 120) {
 }
 
@@ -812,15 +826,15 @@ void HashJoinGlobalSourceState::PrepareBuild(HashJoinGlobalSinkState &sink) {
 		return;
 	}
 
-	build_chunk_idx = 0;
 	build_chunk_count = data_collection.ChunkCount();
 	build_chunk_done = 0;
 
-	auto num_threads = NumericCast<idx_t>(TaskScheduler::GetScheduler(sink.context).NumberOfThreads());
-	build_chunks_per_thread = MaxValue<idx_t>((build_chunk_count + num_threads - 1) / num_threads, 1);
-
 	ht.InitializePointerTable();
 
+	auto num_threads = NumericCast<idx_t>(TaskScheduler::GetScheduler(sink.context).NumberOfThreads());
+	build_ranges = ht.GetPointerTableBuildRanges(num_threads);
+	build_range_idx = 0;
+
 	global_stage = HashJoinSourceStage::BUILD;
 }
 
@@ -859,11 +873,9 @@ bool HashJoinGlobalSourceState::AssignTask(HashJoinGlobalSinkState &sink, HashJo
 	lock_guard<mutex> guard(lock);
 	switch (global_stage.load()) {
 	case HashJoinSourceStage::BUILD:
-		if (build_chunk_idx != build_chunk_count) {
+		if (build_range_idx != build_ranges.size()) {
 			lstate.local_stage = global_stage;
-			lstate.build_chunk_idx_from = build_chunk_idx;
-			build_chunk_idx = MinValue<idx_t>(build_chunk_count, build_chunk_idx + build_chunks_per_thread);
-			lstate.build_chunk_idx_to = build_chunk_idx;
+			lstate.build_range = build_ranges[build_range_idx++];
 			return true;
 		}
 		break;
@@ -948,10 +960,10 @@ void HashJoinLocalSourceState::ExternalBuild(HashJoinGlobalSinkState &sink, Hash
 	D_ASSERT(local_stage == HashJoinSourceStage::BUILD);
 
 	auto &ht = *sink.hash_table;
-	ht.Finalize(build_chunk_idx_from, build_chunk_idx_to, true);
+	ht.Finalize(build_range.chunk_idx_from, build_range.chunk_idx_to, build_range.parallel);
 
 	lock_guard<mutex> guard(gstate.lock);
-	gstate.build_chunk_done += build_chunk_idx_to - build_chunk_idx_from;
+	gstate.build_chunk_done += build_range.chunk_idx_to - build_range.chunk_idx_from;
 }
 
 void HashJoinLocalSourceState::ExternalProbe(HashJoinGlobalSinkState &sink, HashJoinGlobalSourceState &gstate,
@@ -6,6 +6,7 @@
 #include "duckdb/common/value_operations/value_operations.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/storage/data_table.hpp"
 
 namespace duckdb {
@@ -84,7 +85,8 @@ public:
 public:
 	void Sink(DataChunk &input);
 	void Combine(TopNHeap &other);
-	void Reduce();
+	//! Reduces the heap to limit + offset entries if it has grown large enough, returns true if the heap was reduced
+	bool Reduce();
 	void Finalize();
 
 	void ExtractBoundaryValues(DataChunk &current_chunk, DataChunk &prev_chunk);
@@ -275,11 +277,11 @@ void TopNHeap::Finalize() {
 	sort_state.Finalize();
 }
 
-void TopNHeap::Reduce() {
+bool TopNHeap::Reduce() {
 	idx_t min_sort_threshold = MaxValue<idx_t>(STANDARD_VECTOR_SIZE * 5ULL, 2ULL * (limit + offset));
 	if (sort_state.count < min_sort_threshold) {
 		// only reduce when we pass two times the limit + offset, or 5 vectors (whichever comes first)
-		return;
+		return false;
 	}
 	sort_state.Finalize();
 	TopNSortState new_state(*this);
@@ -306,6 +308,7 @@ void TopNHeap::Reduce() {
 	}
 
 	sort_state.Move(new_state);
+	return true;
 }
 
 void TopNHeap::ExtractBoundaryValues(DataChunk &current_chunk, DataChunk &prev_chunk) {
@@ -407,6 +410,8 @@ public:
 
 	mutex lock;
 	TopNHeap heap;
+	//! The boundary filter that is pushed into the scan (if any)
+	shared_ptr<DynamicFilterData> filter_data;
 };
 
 class TopNLocalState : public LocalSinkState {
@@ -424,7 +429,15 @@ unique_ptr<LocalSinkState> PhysicalTopN::GetLocalSinkState(ExecutionContext &con
 }
 
 unique_ptr<GlobalSinkState> PhysicalTopN::GetGlobalSinkState(ClientContext &context) const {
-	return make_uniq<TopNGlobalState>(context, types, orders, limit, offset);
+	auto result = make_uniq<TopNGlobalState>(context, types, orders, limit, offset);
+	if (dynamic_filters) {
+		// push the boundary filter into the scan before it is initialized
+		// the filter does not filter anything until we have found our first boundary value
+		result->filter_data = make_shared_ptr<DynamicFilterData>();
+		dynamic_filters->ClearFilters(*this);
+		dynamic_filters->PushFilter(*this, dynamic_filter_column, make_uniq<DynamicFilter>(result->filter_data));
+	}
+	return std::move(result);
 }
 
 //===--------------------------------------------------------------------===//
@@ -432,9 +445,20 @@ unique_ptr<GlobalSinkState> PhysicalTopN::GetGlobalSinkState(ClientContext &cont
 //===--------------------------------------------------------------------===//
 SinkResultType PhysicalTopN::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const {
 	// append to the local sink state
+	auto &gstate = input.global_state.Cast<TopNGlobalState>();
 	auto &sink = input.local_state.Cast<TopNLocalState>();
 	sink.heap.Sink(chunk);
-	sink.heap.Reduce();
+	if (sink.heap.Reduce() && gstate.filter_data) {
+		// the local heap has limit + offset entries: no row that sorts after its boundary value can be in the top-n
+		// push the boundary value of the first ordering column into the scan so these rows are skipped by all threads
+		auto boundary_value = sink.heap.boundary_values.GetValue(0, 0);
+		if (!boundary_value.IsNull()) {
+			auto comparison_type = orders[0].type == OrderType::ASCENDING
+			                           ? ExpressionType::COMPARE_LESSTHANOREQUALTO
+			                           : ExpressionType::COMPARE_GREATERTHANOREQUALTO;
+			gstate.filter_data->SetValue(comparison_type, std::move(boundary_value));
+		}
+	}
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
@@ -505,6 +529,10 @@ string PhysicalTopN::ParamsToString() const {
 		result += orders[i].expression->ToString() + " ";
 		result += orders[i].type == OrderType::DESCENDING ? "DESC" : "ASC";
 	}
+	if (dynamic_filters) {
+		result += "\n[INFOSEPARATOR]\n";
+		result += "Dynamic Filter: " + orders[0].expression->ToString();
+	}
 	return result;
 }
 
@@ -23,8 +23,12 @@ PhysicalTableScan::PhysicalTableScan(vector<LogicalType> types, TableFunction fu
 class TableScanGlobalSourceState : public GlobalSourceState {
 public:
 	TableScanGlobalSourceState(ClientContext &context, const PhysicalTableScan &op) {
+		if (op.dynamic_filters && op.dynamic_filters->HasFilters()) {
+			// filters were pushed into this scan at execution time: combine them with the static filters
+			table_filters = op.dynamic_filters->GetFinalTableFilters(op.table_filters.get());
+		}
 		if (op.function.init_global) {
-			TableFunctionInitInput input(op.bind_data.get(), op.column_ids, op.projection_ids, op.table_filters.get());
+			TableFunctionInitInput input(op.bind_data.get(), op.column_ids, op.projection_ids, GetTableFilters(op));
 			global_state = op.function.init_global(context, input);
 			if (global_state) {
 				max_threads = global_state->MaxThreads();
@@ -35,8 +39,14 @@ public:
 	}
 
 	idx_t max_threads = 0;
+	//! The combined static and dynamic table filters (if any dynamic filters were pushed)
+	unique_ptr<TableFilterSet> table_filters;
 	unique_ptr<GlobalTableFunctionState> global_state;
 
+	optional_ptr<TableFilterSet> GetTableFilters(const PhysicalTableScan &op) const {
+		return table_filters ? table_filters.get() : op.table_filters.get();
+	}
+
 	idx_t MaxThreads() override {
 		return max_threads;
 	}
@@ -47,7 +57,8 @@ public:
 	TableScanLocalSourceState(ExecutionContext &context, TableScanGlobalSourceState &gstate,
 	                          const PhysicalTableScan &op) {
 		if (op.function.init_local) {
-			TableFunctionInitInput input(op.bind_data.get(), op.column_ids, op.projection_ids, op.table_filters.get());
+			TableFunctionInitInput input(op.bind_data.get(), op.column_ids, op.projection_ids,
+			                             gstate.GetTableFilters(op));
 			local_state = op.function.init_local(context, input, gstate.global_state.get());
 		}
 	}
@@ -56,6 +56,7 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalGet &op) {
 		auto node = make_uniq<PhysicalTableScan>(op.returned_types, op.function, std::move(op.bind_data),
 		                                         op.returned_types, op.column_ids, vector<column_t>(), op.names,
 		                                         std::move(table_filters), op.estimated_cardinality, op.extra_info);
+		node->dynamic_filters = op.dynamic_filters;
 		// first check if an additional projection is necessary
 		if (op.column_ids.size() == op.returned_types.size()) {
 			bool projection_necessary = false;
@@ -91,9 +92,11 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalGet &op) {
 		projection->children.push_back(std::move(node));
 		return std::move(projection);
 	} else {
-		return make_uniq<PhysicalTableScan>(op.types, op.function, std::move(op.bind_data), op.returned_types,
-		                                    op.column_ids, op.projection_ids, op.names, std::move(table_filters),
-		                                    op.estimated_cardinality, op.extra_info);
+		auto node = make_uniq<PhysicalTableScan>(op.types, op.function, std::move(op.bind_data), op.returned_types,
+		                                         op.column_ids, op.projection_ids, op.names, std::move(table_filters),
+		                                         op.estimated_cardinality, op.extra_info);
+		node->dynamic_filters = op.dynamic_filters;
+		return std::move(node);
 	}
 }
 
@@ -11,6 +11,8 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalTopN &op)
 
 	auto top_n = make_uniq<PhysicalTopN>(op.types, std::move(op.orders), NumericCast<idx_t>(op.limit),
 	                                     NumericCast<idx_t>(op.offset), op.estimated_cardinality);
+	top_n->dynamic_filters = std::move(op.dynamic_filters);
+	top_n->dynamic_filter_column = op.dynamic_filter_column;
 	top_n->children.push_back(std::move(plan));
 	return std::move(top_n);
 }
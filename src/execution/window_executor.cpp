@@ -897,6 +897,70 @@ bool WindowAggregateExecutor::IsCustomAggregate() {
 	return (mode < WindowAggregationMode::COMBINE);
 }
 
+static bool GetConstantRowsOffset(ClientContext &context, const WindowBoundary boundary, optional_ptr<Expression> expr,
+                                  int64_t &offset) {
+	switch (boundary) {
+	case WindowBoundary::CURRENT_ROW_ROWS:
+		offset = 0;
+		return true;
+	case WindowBoundary::EXPR_PRECEDING_ROWS:
+	case WindowBoundary::EXPR_FOLLOWING_ROWS: {
+		if (!expr || !expr->IsFoldable()) {
+			return false;
+		}
+		Value value;
+		if (!ExpressionExecutor::TryEvaluateScalar(context, *expr, value) || value.IsNull() ||
+		    !value.DefaultTryCastAs(LogicalType::BIGINT)) {
+			return false;
+		}
+		offset = value.GetValue<int64_t>();
+		if (offset < 0) {
+			//	Invalid offsets are reported when computing the frame boundaries
+			return false;
+		}
+		if (boundary == WindowBoundary::EXPR_PRECEDING_ROWS) {
+			offset = -offset;
+		}
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+bool WindowAggregateExecutor::IsSlidingAggregate(idx_t &frame_width) {
+	if (!wexpr.aggregate) {
+		return false;
+	}
+	// window exclusion and distinct aggregates cannot be handled by sliding aggregates
+	if (wexpr.exclude_clause != WindowExcludeMode::NO_OTHER || wexpr.distinct) {
+		return false;
+	}
+	if (wexpr.children.empty() || mode >= WindowAggregationMode::COMBINE) {
+		return false;
+	}
+	//	The block prefixes and suffixes are combined, so the order of the combines must not matter
+	auto &function = *wexpr.aggregate;
+	if (!function.combine || function.order_dependent != AggregateOrderDependent::NOT_ORDER_DEPENDENT) {
+		return false;
+	}
+
+	//	The frames must have a constant width, i.e., ROWS frames with constant offsets
+	int64_t start_offset;
+	int64_t end_offset;
+	if (!GetConstantRowsOffset(context, wexpr.start, wexpr.start_expr.get(), start_offset) ||
+	    !GetConstantRowsOffset(context, wexpr.end, wexpr.end_expr.get(), end_offset)) {
+		return false;
+	}
+	int64_t width;
+	if (!TrySubtractOperator::Operation(end_offset, start_offset, width) || width < 0 ||
+	    width >= NumericCast<int64_t>(WindowSlidingAggregator::MAX_FRAME_WIDTH)) {
+		return false;
+	}
+	frame_width = NumericCast<idx_t>(width + 1);
+	return true;
+}
+
 void WindowExecutor::Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &result,
                               WindowExecutorState &lstate) const {
 	auto &lbstate = lstate.Cast<WindowExecutorBoundsState>();
@@ -917,6 +981,7 @@ WindowAggregateExecutor::WindowAggregateExecutor(BoundWindowExpression &wexpr, C
 	const auto force_naive =
 	    !ClientConfig::GetConfig(context).enable_optimizer || mode == WindowAggregationMode::SEPARATE;
 	AggregateObject aggr(wexpr);
+	idx_t frame_width = 0;
 	if (force_naive || (wexpr.distinct && wexpr.exclude_clause != WindowExcludeMode::NO_OTHER)) {
 		aggregator = make_uniq<WindowNaiveAggregator>(aggr, wexpr.return_type, wexpr.exclude_clause, count);
 	} else if (IsDistinctAggregate()) {
@@ -928,6 +993,10 @@ WindowAggregateExecutor::WindowAggregateExecutor(BoundWindowExpression &wexpr, C
 		    make_uniq<WindowConstantAggregator>(aggr, wexpr.return_type, partition_mask, wexpr.exclude_clause, count);
 	} else if (IsCustomAggregate()) {
 		aggregator = make_uniq<WindowCustomAggregator>(aggr, wexpr.return_type, wexpr.exclude_clause, count);
+	} else if (IsSlidingAggregate(frame_width)) {
+		// slide fixed-width frames over blocks of the frame width instead of building a segment tree
+		aggregator =
+		    make_uniq<WindowSlidingAggregator>(aggr, wexpr.return_type, wexpr.exclude_clause, count, frame_width);
 	} else {
 		// build a segment tree for frame-adhering aggregates
 		// see http://www.vldb.org/pvldb/vol8/p1058-leis.pdf
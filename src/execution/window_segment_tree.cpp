@@ -594,6 +594,299 @@ void WindowNaiveAggregator::Evaluate(WindowAggregatorState &lstate, const DataCh
 	ldstate.Evaluate(bounds, result, count, row_idx);
 }
 
+//===--------------------------------------------------------------------===//
+// WindowSlidingAggregator
+//===--------------------------------------------------------------------===//
+WindowSlidingAggregator::WindowSlidingAggregator(AggregateObject aggr, const LogicalType &result_type,
+                                                 const WindowExcludeMode exclude_mode_p, idx_t count,
+                                                 idx_t frame_width_p)
+    : WindowAggregator(std::move(aggr), result_type, exclude_mode_p, count), frame_width(frame_width_p) {
+	D_ASSERT(frame_width > 0 && frame_width <= MAX_FRAME_WIDTH);
+}
+
+WindowSlidingAggregator::~WindowSlidingAggregator() {
+}
+
+class WindowSlidingState : public WindowAggregatorState {
+public:
+	explicit WindowSlidingState(const WindowSlidingAggregator &gstate);
+
+	void Evaluate(const DataChunk &bounds, Vector &result, idx_t count);
+
+protected:
+	//! Computes the block prefixes and suffixes of [lo, hi) and combines them into the results of [begin, end)
+	void EvaluateBlocks(const DataChunk &bounds, idx_t begin, idx_t end, idx_t lo, idx_t hi);
+	//! Updates the state with the input row (if it passes the filter)
+	void UpdateState(data_ptr_t state_ptr, idx_t row);
+	//! Combines the source state into the target state
+	void CombineState(data_ptr_t source_ptr, data_ptr_t target_ptr);
+	void FlushUpdates();
+	void FlushCombines();
+	//! Calls the destructor on the states in [states, states + count)
+	void DestroyStates(data_ptr_t states, idx_t count);
+
+	//! The global state
+	const WindowSlidingAggregator &gstate;
+	//! The maximum number of rows [lo, hi) of which we compute the block prefixes and suffixes at once
+	const idx_t capacity;
+	//! The block prefix states: the aggregate of the rows from the block start up to and including the row
+	vector<data_t> prefixes;
+	//! The block suffix states: the aggregate of the rows from the row up to the block end
+	vector<data_t> suffixes;
+	//! The result states
+	vector<data_t> results;
+	//! Reused result state container for the aggregate
+	Vector statef;
+	//! Pointers to the states that are updated or combined into
+	Vector statep;
+	//! Pointers to the states that are combined
+	Vector statel;
+	//! Pointers to the states that are updated
+	Vector stateu;
+	//! Input data chunk, used for updating the states
+	DataChunk leaves;
+	//! The input rows of the states that are updated
+	SelectionVector update_sel;
+	//! Count of buffered updates
+	idx_t update_count;
+	//! Count of buffered combines
+	idx_t combine_count;
+};
+
+WindowSlidingState::WindowSlidingState(const WindowSlidingAggregator &gstate)
+    : gstate(gstate), capacity(STANDARD_VECTOR_SIZE + gstate.frame_width), prefixes(gstate.state_size * capacity),
+      suffixes(gstate.state_size * capacity), results(gstate.state_size * STANDARD_VECTOR_SIZE),
+      statef(LogicalType::POINTER), statep(LogicalType::POINTER), statel(LogicalType::POINTER),
+      stateu(LogicalType::POINTER), update_count(0), combine_count(0) {
+	auto &inputs = gstate.GetInputs();
+	if (inputs.ColumnCount() > 0) {
+		leaves.Initialize(Allocator::DefaultAllocator(), inputs.GetTypes());
+	}
+	update_sel.Initialize();
+
+	//	Build the finalise vector that just points to the result states
+	data_ptr_t state_ptr = results.data();
+	D_ASSERT(statef.GetVectorType() == VectorType::FLAT_VECTOR);
+	statef.SetVectorType(VectorType::CONSTANT_VECTOR);
+	statef.Flatten(STANDARD_VECTOR_SIZE);
+	auto fdata = FlatVector::GetData<data_ptr_t>(statef);
+	for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; ++i) {
+		fdata[i] = state_ptr;
+		state_ptr += gstate.state_size;
+	}
+}
+
+void WindowSlidingState::FlushUpdates() {
+	if (!update_count) {
+		return;
+	}
+
+	auto &inputs = gstate.GetInputs();
+	leaves.Slice(inputs, update_sel, update_count);
+
+	auto &aggr = gstate.aggr;
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+	aggr.function.update(leaves.data.data(), aggr_input_data, leaves.ColumnCount(), stateu, update_count);
+
+	update_count = 0;
+}
+
+void WindowSlidingState::FlushCombines() {
+	if (!combine_count) {
+		return;
+	}
+
+	auto &aggr = gstate.aggr;
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+	statel.Verify(combine_count);
+	aggr.function.combine(statel, statep, aggr_input_data, combine_count);
+
+	combine_count = 0;
+}
+
+void WindowSlidingState::UpdateState(data_ptr_t state_ptr, idx_t row) {
+	if (!gstate.GetFilterMask().RowIsValid(row)) {
+		return;
+	}
+	FlatVector::GetData<data_ptr_t>(stateu)[update_count] = state_ptr;
+	update_sel.set_index(update_count++, row);
+	if (update_count >= STANDARD_VECTOR_SIZE) {
+		FlushUpdates();
+	}
+}
+
+void WindowSlidingState::CombineState(data_ptr_t source_ptr, data_ptr_t target_ptr) {
+	FlatVector::GetData<data_ptr_t>(statel)[combine_count] = source_ptr;
+	FlatVector::GetData<data_ptr_t>(statep)[combine_count] = target_ptr;
+	if (++combine_count >= STANDARD_VECTOR_SIZE) {
+		FlushCombines();
+	}
+}
+
+void WindowSlidingState::DestroyStates(data_ptr_t states, idx_t count) {
+	auto &aggr = gstate.aggr;
+	if (!aggr.function.destructor) {
+		return;
+	}
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+	auto pdata = FlatVector::GetData<data_ptr_t>(statep);
+	idx_t flush_count = 0;
+	for (idx_t i = 0; i < count; ++i) {
+		pdata[flush_count++] = states + i * gstate.state_size;
+		if (flush_count >= STANDARD_VECTOR_SIZE) {
+			aggr.function.destructor(statep, aggr_input_data, flush_count);
+			flush_count = 0;
+		}
+	}
+	if (flush_count) {
+		aggr.function.destructor(statep, aggr_input_data, flush_count);
+	}
+}
+
+void WindowSlidingState::EvaluateBlocks(const DataChunk &bounds, idx_t begin, idx_t end, idx_t lo, idx_t hi) {
+	auto &aggr = gstate.aggr;
+	const auto state_size = gstate.state_size;
+	const auto width = gstate.frame_width;
+
+	auto partition_begin = FlatVector::GetData<const idx_t>(bounds.data[PARTITION_BEGIN]);
+	auto partition_end = FlatVector::GetData<const idx_t>(bounds.data[PARTITION_END]);
+	auto window_begin = FlatVector::GetData<const idx_t>(bounds.data[WINDOW_BEGIN]);
+	auto window_end = FlatVector::GetData<const idx_t>(bounds.data[WINDOW_END]);
+	auto fdata = FlatVector::GetData<data_ptr_t>(statef);
+
+	//	The blocks are aligned with the partition start
+	const auto partition_start = partition_begin[begin];
+	const auto first_block = partition_start + ((lo - partition_start) / width) * width;
+
+	const auto count = hi - lo;
+	D_ASSERT(count <= capacity);
+	auto prefix = [&](idx_t row) {
+		return prefixes.data() + (row - lo) * state_size;
+	};
+	auto suffix = [&](idx_t row) {
+		return suffixes.data() + (row - lo) * state_size;
+	};
+
+	//	Every prefix and suffix starts out with its own row
+	for (idx_t row = lo; row < hi; ++row) {
+		aggr.function.initialize(prefix(row));
+		aggr.function.initialize(suffix(row));
+		UpdateState(prefix(row), row);
+		UpdateState(suffix(row), row);
+	}
+	FlushUpdates();
+
+	//	Accumulate the prefixes and suffixes of all the blocks in lock step
+	for (idx_t step = 1; step < MinValue(width, count); ++step) {
+		for (auto block_start = first_block; block_start < hi; block_start += width) {
+			const auto block_lo = MaxValue(block_start, lo);
+			const auto block_hi = MinValue(block_start + width, hi);
+			if (block_lo + step < block_hi) {
+				CombineState(prefix(block_lo + step - 1), prefix(block_lo + step));
+				CombineState(suffix(block_hi - step), suffix(block_hi - step - 1));
+			}
+		}
+		FlushCombines();
+	}
+
+	//	Every frame is now a block suffix followed by a block prefix
+	for (idx_t i = begin; i < end; ++i) {
+		const auto frame_begin = window_begin[i];
+		const auto frame_end = window_end[i];
+		if (frame_begin >= frame_end || frame_end - frame_begin > width) {
+			continue;
+		}
+		const auto block_start = partition_start + ((frame_begin - partition_start) / width) * width;
+		const auto block_end = MinValue(block_start + width, partition_end[i]);
+		if (frame_end > block_end) {
+			CombineState(suffix(frame_begin), fdata[i]);
+			CombineState(prefix(frame_end - 1), fdata[i]);
+		} else if (frame_begin == block_start) {
+			CombineState(prefix(frame_end - 1), fdata[i]);
+		} else if (frame_end == block_end) {
+			CombineState(suffix(frame_begin), fdata[i]);
+		} else {
+			//	A frame in the middle of a block: aggregate it directly
+			for (auto row = frame_begin; row < frame_end; ++row) {
+				UpdateState(fdata[i], row);
+			}
+		}
+	}
+	FlushCombines();
+	FlushUpdates();
+
+	DestroyStates(prefixes.data(), count);
+	DestroyStates(suffixes.data(), count);
+}
+
+void WindowSlidingState::Evaluate(const DataChunk &bounds, Vector &result, idx_t count) {
+	auto &aggr = gstate.aggr;
+	const auto width = gstate.frame_width;
+
+	auto partition_begin = FlatVector::GetData<const idx_t>(bounds.data[PARTITION_BEGIN]);
+	auto window_begin = FlatVector::GetData<const idx_t>(bounds.data[WINDOW_BEGIN]);
+	auto window_end = FlatVector::GetData<const idx_t>(bounds.data[WINDOW_END]);
+	auto fdata = FlatVector::GetData<data_ptr_t>(statef);
+
+	for (idx_t i = 0; i < count; ++i) {
+		aggr.function.initialize(fdata[i]);
+	}
+
+	//	Group the rows into batches within the same partition whose frames fit into the block states
+	idx_t batch_begin = 0;
+	idx_t lo = 0;
+	idx_t hi = 0;
+	for (idx_t i = 0; i < count; ++i) {
+		const auto frame_begin = window_begin[i];
+		const auto frame_end = window_end[i];
+		if (frame_begin >= frame_end) {
+			continue;
+		}
+		if (frame_end - frame_begin > width) {
+			//	A wider frame: aggregate it directly
+			for (auto row = frame_begin; row < frame_end; ++row) {
+				UpdateState(fdata[i], row);
+			}
+			continue;
+		}
+		if (lo < hi) {
+			if (partition_begin[i] == partition_begin[batch_begin] &&
+			    MaxValue(hi, frame_end) - MinValue(lo, frame_begin) <= capacity) {
+				lo = MinValue(lo, frame_begin);
+				hi = MaxValue(hi, frame_end);
+				continue;
+			}
+			EvaluateBlocks(bounds, batch_begin, i, lo, hi);
+		}
+		batch_begin = i;
+		lo = frame_begin;
+		hi = frame_end;
+	}
+	if (lo < hi) {
+		EvaluateBlocks(bounds, batch_begin, count, lo, hi);
+	}
+	FlushUpdates();
+
+	//	Finalise the result aggregates and write to the result
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+	aggr.function.finalize(statef, aggr_input_data, result, count, 0);
+
+	//	Destruct the result aggregates
+	if (aggr.function.destructor) {
+		aggr.function.destructor(statef, aggr_input_data, count);
+	}
+}
+
+unique_ptr<WindowAggregatorState> WindowSlidingAggregator::GetLocalState() const {
+	return make_uniq<WindowSlidingState>(*this);
+}
+
+void WindowSlidingAggregator::Evaluate(WindowAggregatorState &lstate, const DataChunk &bounds, Vector &result,
+                                       idx_t count, idx_t row_idx) const {
+	auto &lsstate = lstate.Cast<WindowSlidingState>();
+	lsstate.Evaluate(bounds, result, count);
+}
+
 //===--------------------------------------------------------------------===//
 // WindowSegmentTree
 //===--------------------------------------------------------------------===//
@@ -8,6 +8,7 @@
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/query_profiler.hpp"
 #include "duckdb/main/secret/secret_manager.hpp"
+#include "duckdb/parallel/resource_group.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/planner/expression_binder.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
@@ -122,6 +123,42 @@ static void PragmaDisableOptimizer(ClientContext &context, const FunctionParamet
 	ClientConfig::GetConfig(context).enable_optimizer = false;
 }
 
+static void PragmaCreateResourceGroup(ClientContext &context, const FunctionParameters &parameters) {
+	auto name = parameters.values[0].ToString();
+	if (name.empty()) {
+		throw InvalidInputException("The name of a resource group cannot be empty");
+	}
+	// parse all parameters before we create the group
+	int64_t priority = 0;
+	double thread_share = 1.0;
+	idx_t memory_limit = NumericLimits<idx_t>::Maximum();
+	auto entry = parameters.named_parameters.find("priority");
+	if (entry != parameters.named_parameters.end()) {
+		priority = entry->second.GetValue<int64_t>();
+	}
+	entry = parameters.named_parameters.find("thread_share");
+	if (entry != parameters.named_parameters.end()) {
+		thread_share = entry->second.GetValue<double>();
+		if (!(thread_share > 0 && thread_share <= 1)) {
+			throw InvalidInputException("The thread_share of a resource group must be in the range (0, 1]");
+		}
+	}
+	entry = parameters.named_parameters.find("memory_limit");
+	if (entry != parameters.named_parameters.end()) {
+		memory_limit = DBConfig::ParseMemoryLimit(entry->second.ToString());
+	}
+
+	auto &scheduler = TaskScheduler::GetScheduler(context);
+	auto &group = scheduler.CreateResourceGroup(name);
+	scheduler.SetResourceGroupPriority(group, priority);
+	group.thread_share = thread_share;
+	group.memory_limit = memory_limit;
+}
+
+static void PragmaDropResourceGroup(ClientContext &context, const FunctionParameters &parameters) {
+	TaskScheduler::GetScheduler(context).DropResourceGroup(parameters.values[0].ToString());
+}
+
 void PragmaFunctions::RegisterFunction(BuiltinFunctions &set) {
 	RegisterEnableProfiling(set);
 
@@ -157,6 +194,15 @@ void PragmaFunctions::RegisterFunction(BuiltinFunctions &set) {
 	set.AddFunction(PragmaFunction::PragmaStatement("enable_print_progress_bar", PragmaEnablePrintProgressBar));
 	set.AddFunction(PragmaFunction::PragmaStatement("disable_print_progress_bar", PragmaDisablePrintProgressBar));
 
+	auto create_resource_group =
+	    PragmaFunction::PragmaCall("create_resource_group", PragmaCreateResourceGroup, {LogicalType::VARCHAR});
+	create_resource_group.named_parameters["priority"] = LogicalType::BIGINT;
+	create_resource_group.named_parameters["thread_share"] = LogicalType::DOUBLE;
+	create_resource_group.named_parameters["memory_limit"] = LogicalType::VARCHAR;
+	set.AddFunction(create_resource_group);
+	set.AddFunction(
+	    PragmaFunction::PragmaCall("drop_resource_group", PragmaDropResourceGroup, {LogicalType::VARCHAR}));
+
 	set.AddFunction(PragmaFunction::PragmaStatement("enable_checkpoint_on_shutdown", PragmaEnableCheckpointOnShutdown));
 	set.AddFunction(
 	    PragmaFunction::PragmaStatement("disable_checkpoint_on_shutdown", PragmaDisableCheckpointOnShutdown));
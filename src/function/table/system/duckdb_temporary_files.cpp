@@ -19,6 +19,12 @@ static unique_ptr<FunctionData> DuckDBTemporaryFilesBind(ClientContext &context,
 	names.emplace_back("size");
 	return_types.emplace_back(LogicalType::BIGINT);
 
+	names.emplace_back("uncompressed_size");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("compression_ratio");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
 	return nullptr;
 }
 
@@ -42,10 +48,16 @@ void DuckDBTemporaryFilesFunction(ClientContext &context, TableFunctionInput &da
 		auto &entry = data.entries[data.offset++];
 		// return values:
 		idx_t col = 0;
-		// database_name, VARCHAR
+		// path, VARCHAR
 		output.SetValue(col++, count, entry.path);
-		// database_oid, BIGINT
+		// size, BIGINT
 		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.size)));
+		// uncompressed_size, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.uncompressed_size)));
+		// compression_ratio, DOUBLE
+		auto compression_ratio =
+		    entry.size == 0 ? 1.0 : static_cast<double>(entry.uncompressed_size) / static_cast<double>(entry.size);
+		output.SetValue(col++, count, Value::DOUBLE(compression_ratio));
 		count++;
 	}
 	output.SetCardinality(count);
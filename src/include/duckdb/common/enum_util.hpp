@@ -300,6 +300,8 @@ enum class TableColumnType : uint8_t;
 
 enum class TableFilterType : uint8_t;
 
+enum class TableFunctionInitialization : uint8_t;
+
 enum class TableReferenceType : uint8_t;
 
 enum class TableScanType : uint8_t;
@@ -739,6 +741,9 @@ const char* EnumUtil::ToChars<TableColumnType>(TableColumnType value);
 template<>
 const char* EnumUtil::ToChars<TableFilterType>(TableFilterType value);
 
+template<>
+const char* EnumUtil::ToChars<TableFunctionInitialization>(TableFunctionInitialization value);
+
 template<>
 const char* EnumUtil::ToChars<TableReferenceType>(TableReferenceType value);
 
@@ -1196,6 +1201,9 @@ TableColumnType EnumUtil::FromString<TableColumnType>(const char *value);
 template<>
 TableFilterType EnumUtil::FromString<TableFilterType>(const char *value);
 
+template<>
+TableFunctionInitialization EnumUtil::FromString<TableFunctionInitialization>(const char *value);
+
 template<>
 TableReferenceType EnumUtil::FromString<TableReferenceType>(const char *value);
 
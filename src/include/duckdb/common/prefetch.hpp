@@ -0,0 +1,15 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/prefetch.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#if __GNUC__
+#define DUCKDB_PREFETCH(ptr) (__builtin_prefetch(ptr))
+#else
+#define DUCKDB_PREFETCH(ptr) ((void)(ptr))
+#endif
@@ -37,14 +37,33 @@ public:
 		throw NotImplementedException("Cannot create data from this type");
 	}
 
-	static inline void EncodeStringDataPrefix(data_ptr_t dataptr, string_t value, idx_t prefix_len) {
-		auto len = value.GetSize();
-		memcpy(dataptr, value.GetData(), MinValue(len, prefix_len));
+	static inline void EncodeStringDataPrefix(data_ptr_t dataptr, const char *data, idx_t len, idx_t prefix_len) {
+		memcpy(dataptr, data, MinValue(len, prefix_len));
 		if (len < prefix_len) {
 			memset(dataptr + len, '\0', prefix_len - len);
 		}
 	}
 
+	static inline void EncodeStringDataPrefix(data_ptr_t dataptr, string_t value, idx_t prefix_len) {
+		EncodeStringDataPrefix(dataptr, value.GetData(), value.GetSize(), prefix_len);
+	}
+
+	//! Encodes the bytes that follow the prefix that all strings are expected to share
+	//! Strings that do not start with the prefix (e.g., because the statistics are outdated) are encoded as all zero
+	//! bytes if they sort before the strings that do, and as all 0xFF bytes otherwise. Ties must be broken on the
+	//! full string
+	static inline void EncodeStringDataPrefix(data_ptr_t dataptr, string_t value, idx_t prefix_len,
+	                                          const string &common_prefix) {
+		const auto size = value.GetSize();
+		const auto offset = common_prefix.size();
+		const auto cmp = memcmp(value.GetData(), common_prefix.data(), MinValue<idx_t>(size, offset));
+		if (cmp == 0 && size >= offset) {
+			EncodeStringDataPrefix(dataptr, value.GetData() + offset, size - offset, prefix_len);
+		} else {
+			memset(dataptr, cmp <= 0 ? 0x00 : 0xFF, prefix_len);
+		}
+	}
+
 	static inline uint8_t FlipSign(uint8_t key_byte) {
 		return key_byte ^ 128;
 	}
@@ -123,7 +123,7 @@ struct RowOperations {
 	//! Scatter vector data to the rows in radix-sortable format.
 	static void RadixScatter(Vector &v, idx_t vcount, const SelectionVector &sel, idx_t ser_count,
 	                         data_ptr_t key_locations[], bool desc, bool has_null, bool nulls_first, idx_t prefix_len,
-	                         idx_t width, idx_t offset = 0);
+	                         idx_t width, idx_t offset = 0, const string &common_prefix = string());
 
 	//===--------------------------------------------------------------------===//
 	// Out-of-Core Operators
@@ -41,6 +41,9 @@ public:
 	vector<bool> constant_size;
 	vector<idx_t> column_sizes;
 	vector<idx_t> prefix_lengths;
+	//! The prefix that all strings of a column share (according to the statistics)
+	//! These bytes do not discriminate, and are left out of the radix sorting key
+	vector<string> common_prefixes;
 	vector<BaseStatistics *> stats;
 	vector<bool> has_null;
 
@@ -0,0 +1,81 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/ht_entry.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+
+namespace duckdb {
+
+//! The ht_entry_t struct represents an individual entry within a hash table.
+/*!
+    This struct is used by the JoinHashTable and AggregateHashTable to store entries within the hash table. It stores
+    a pointer to the data and a salt value in a single hash_t and can return or modify the pointer and salt
+    individually.
+*/
+struct ht_entry_t { // NOLINT
+public:
+	ht_entry_t() noexcept : value(0) {
+	}
+
+	explicit ht_entry_t(hash_t value_p) noexcept : value(value_p) {
+	}
+
+	ht_entry_t(const hash_t &salt, const data_ptr_t &pointer) noexcept
+	    : value(reinterpret_cast<uint64_t>(pointer) | (salt & SALT_MASK)) {
+	}
+
+	inline bool IsOccupied() const {
+		return value != 0;
+	}
+
+	inline data_ptr_t GetPointer() const {
+		D_ASSERT(IsOccupied());
+		return reinterpret_cast<data_ptr_t>(value & POINTER_MASK);
+	}
+	inline void SetPointer(const data_ptr_t &pointer) {
+		// Pointer shouldn't use upper bits
+		D_ASSERT((reinterpret_cast<uint64_t>(pointer) & SALT_MASK) == 0);
+		// Value should have all 1's in the pointer area
+		D_ASSERT((value & POINTER_MASK) == POINTER_MASK);
+		// Set upper bits to 1 in pointer so the salt stays intact
+		value &= reinterpret_cast<uint64_t>(pointer) | SALT_MASK;
+	}
+
+	static inline hash_t ExtractSalt(const hash_t &hash) {
+		// Leaves upper bits intact, sets lower bits to all 1's
+		return hash | POINTER_MASK;
+	}
+	inline hash_t GetSalt() const {
+		return ExtractSalt(value);
+	}
+	inline void SetSalt(const hash_t &salt) {
+		// Shouldn't be occupied when we set this
+		D_ASSERT(!IsOccupied());
+		// Salt should have all 1's in the pointer field
+		D_ASSERT((salt & POINTER_MASK) == POINTER_MASK);
+		// No need to mask, just put the whole thing there
+		value = salt;
+	}
+
+	//! Returns an entry with the salt of this entry, pointing to the given pointer
+	inline ht_entry_t WithPointer(const data_ptr_t &pointer) const {
+		D_ASSERT(IsOccupied());
+		return ht_entry_t(value, pointer);
+	}
+
+private:
+	//! Upper 16 bits are salt
+	static constexpr const hash_t SALT_MASK = 0xFFFF000000000000;
+	//! Lower 48 bits are the pointer
+	static constexpr const hash_t POINTER_MASK = 0x0000FFFFFFFFFFFF;
+
+	hash_t value;
+};
+
+} // namespace duckdb
@@ -17,6 +17,7 @@
 #include "duckdb/common/types/row/tuple_data_layout.hpp"
 #include "duckdb/common/types/vector.hpp"
 #include "duckdb/execution/aggregate_hashtable.hpp"
+#include "duckdb/execution/ht_entry.hpp"
 #include "duckdb/planner/operator/logical_comparison_join.hpp"
 #include "duckdb/storage/storage_info.hpp"
 
@@ -49,12 +50,15 @@ private:
    data ptrs. The storage looks like this internally.
    [SERIALIZED ROW][NEXT POINTER]
    [SERIALIZED ROW][NEXT POINTER]
-   There is a separate hash map of pointers that point into this table.
+   There is a separate hash map of entries that point into this table.
    This is what is used to resolve the hashes.
-   [POINTER]
-   [POINTER]
-   [POINTER]
-   The pointers are either NULL
+   [SALT][POINTER]
+   [SALT][POINTER]
+   [SALT][POINTER]
+   The entries are either empty, or hold a salt (the upper bits of the hash) and a
+   pointer to the head of a chain of rows that have this salt. Collisions are
+   resolved with linear probing, and the salt is used to skip most collisions
+   without having to follow the pointer into the row data.
 */
 class JoinHashTable {
 public:
@@ -65,6 +69,23 @@ public:
 	//! returned by the JoinHashTable::Scan function and can be used to resume a
 	//! probe.
 	struct ScanStructure {
+		//! State for scanning the chains of the remaining probe rows in one go, only created if we do
+		struct ChainScanState {
+			explicit ChainScanState(const vector<LogicalType> &key_types);
+
+			//! The pointers to the collected chain entries
+			Vector pointers;
+			//! The probe row of every collected chain entry
+			SelectionVector chain_sel;
+			//! The collected chain entries whose keys match
+			SelectionVector match_sel;
+			//! The probe rows of the matching chain entries
+			SelectionVector result_sel;
+			//! The keys of the probe rows of the collected chain entries
+			DataChunk keys;
+			TupleDataChunkState key_state;
+		};
+
 		TupleDataChunkState &key_state;
 		Vector pointers;
 		idx_t count;
@@ -73,6 +94,12 @@ public:
 		unsafe_unique_array<bool> found_match;
 		JoinHashTable &ht;
 		bool finished;
+		//! Whether the few remaining probe rows have long chains that we scan in one go
+		bool scan_chains;
+		unique_ptr<ChainScanState> chain_state;
+
+		//! If fewer probe rows than this still have matches after a step, their chains are scanned in one go
+		static constexpr const idx_t CHAIN_SCAN_THRESHOLD = STANDARD_VECTOR_SIZE / 4;
 
 		explicit ScanStructure(JoinHashTable &ht, TupleDataChunkState &key_state);
 		//! Get the next batch of data from the scan structure
@@ -83,6 +110,8 @@ public:
 	private:
 		//! Next operator for the inner join
 		void NextInnerJoin(DataChunk &keys, DataChunk &left, DataChunk &result);
+		//! Next operator for the inner join, scanning the (long) chains of the remaining probe rows in one go
+		void NextInnerJoinChains(DataChunk &keys, DataChunk &left, DataChunk &result);
 		//! Next operator for the semi join
 		void NextSemiJoin(DataChunk &keys, DataChunk &left, DataChunk &result);
 		//! Next operator for the anti join
@@ -114,6 +143,28 @@ public:
 		idx_t ResolvePredicates(DataChunk &keys, SelectionVector &match_sel, SelectionVector *no_match_sel);
 	};
 
+	//! The pointer table is divided into partitions, one for each radix partition of the data in the HT. Each
+	//! partition has its own (power of two) capacity, so that it can be built independently of the other partitions
+	struct PointerTablePartition {
+		//! The number of rows in this partition
+		idx_t count;
+		//! The range of chunks of the data collection that hold the rows of this partition
+		idx_t chunk_idx_from;
+		idx_t chunk_idx_to;
+		//! The offset of this partition in the pointer table
+		idx_t ht_offset;
+		//! Bitmask for getting relevant bits from the hashes to determine the position within this partition
+		uint64_t bitmask;
+	};
+
+	//! A range of chunks of the data collection that is inserted into the pointer table by a single thread
+	struct PointerTableBuildRange {
+		idx_t chunk_idx_from;
+		idx_t chunk_idx_to;
+		//! Whether other threads insert rows of the same pointer table partition (and we need atomics)
+		bool parallel;
+	};
+
 public:
 	JoinHashTable(BufferManager &buffer_manager, const vector<JoinCondition> &conditions,
 	              vector<LogicalType> build_types, JoinType type, const vector<idx_t> &output_columns);
@@ -127,6 +178,8 @@ public:
 	void Unpartition();
 	//! Initialize the pointer table for the probe
 	void InitializePointerTable();
+	//! Divides the construction of the pointer table into ranges of chunks for (at most) the given number of threads
+	vector<PointerTableBuildRange> GetPointerTableBuildRanges(idx_t num_threads) const;
 	//! Finalize the build of the HT, constructing the actual hash table and making the HT ready for probing.
 	//! Finalize must be called before any call to Probe, and after Finalize is called Build should no longer be
 	//! ever called.
@@ -188,8 +241,8 @@ public:
 	bool finalized;
 	//! Whether or not any of the key elements contain NULL
 	bool has_null;
-	//! Bitmask for getting relevant bits from the hashes to determine the position
-	uint64_t bitmask;
+	//! Whether or not to prefetch the pointer table entries and rows while probing
+	bool prefetch_probe;
 
 	struct {
 		mutex mj_lock;
@@ -213,13 +266,14 @@ private:
 	                                                  const SelectionVector *&current_sel);
 	void Hash(DataChunk &keys, const SelectionVector &sel, idx_t count, Vector &hashes);
 
-	//! Apply a bitmask to the hashes
-	void ApplyBitmask(Vector &hashes, idx_t count);
-	void ApplyBitmask(Vector &hashes, const SelectionVector &sel, idx_t count, Vector &pointers);
+	//! Look up the hashes in the pointer table, setting the pointers to the head of the matching row chain (or NULL)
+	void GetRowPointers(Vector &hashes, const SelectionVector &sel, idx_t count, Vector &pointers);
 
 private:
 	//! Insert the given set of locations into the HT with the given set of hashes
 	void InsertHashes(Vector &hashes, idx_t count, data_ptr_t key_locations[], bool parallel);
+	//! Set up the pointer table partitions for the given (consecutive) radix partitions of sink_collection
+	void InitializePointerTablePartitions(idx_t partition_idx_from, idx_t partition_idx_to);
 
 	idx_t PrepareKeys(DataChunk &keys, vector<TupleDataVectorFormat> &vector_data, const SelectionVector *&current_sel,
 	                  SelectionVector &sel, bool build_side);
@@ -232,6 +286,10 @@ private:
 	unique_ptr<TupleDataCollection> data_collection;
 	//! The hash map of the HT, created after finalization
 	AllocatedData hash_map;
+	//! The partitions of the hash map, one for each radix partition of sink_collection that is in data_collection
+	vector<PointerTablePartition> pointer_table_partitions;
+	//! The radix partition of the first pointer table partition
+	idx_t pointer_table_partition_start;
 	//! Whether or not NULL values are considered equal in each of the comparisons
 	vector<bool> null_values_are_equal;
 
@@ -301,6 +359,9 @@ public:
 		return partition_end;
 	}
 
+	//! HT size (in bytes) above which we prefetch while probing
+	static constexpr const idx_t PREFETCH_THRESHOLD = 4ULL * 1024ULL * 1024ULL;
+
 	//! Capacity of the pointer table given the ht count
 	//! (minimum of 1024 to prevent collision chance for small HT's)
 	static idx_t PointerTableCapacity(idx_t count) {
@@ -308,7 +369,7 @@ public:
 	}
 	//! Size of the pointer table (in bytes)
 	static idx_t PointerTableSize(idx_t count) {
-		return PointerTableCapacity(count) * sizeof(data_ptr_t);
+		return PointerTableCapacity(count) * sizeof(ht_entry_t);
 	}
 
 	//! Get total size of HT if all partitions would be built
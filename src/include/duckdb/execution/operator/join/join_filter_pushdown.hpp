@@ -0,0 +1,60 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/join/join_filter_pushdown.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/types/data_chunk.hpp"
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+
+namespace duckdb {
+class PhysicalOperator;
+
+struct JoinFilterPushdownColumn {
+	//! The join condition (index into the conditions of the join) whose key range is pushed
+	idx_t join_condition;
+	//! The column index in the probe-side scan the filter is pushed into
+	idx_t probe_column_index;
+};
+
+struct JoinFilterGlobalState {
+	mutex lock;
+	//! The min/max of the build-side keys, per pushed down column
+	vector<unique_ptr<BaseStatistics>> key_stats;
+};
+
+struct JoinFilterLocalState {
+	//! The min/max of the build-side keys seen by this thread, per pushed down column
+	vector<unique_ptr<BaseStatistics>> key_stats;
+};
+
+//! JoinFilterPushdownInfo collects the min/max of the build-side join keys during the hash join build, and pushes
+//! them as dynamic range filters into the probe-side table scan once the build is finished
+struct JoinFilterPushdownInfo {
+	//! The dynamic filter set of the probe-side scan
+	shared_ptr<DynamicTableFilterSet> dynamic_filters;
+	//! The join conditions that are pushed into the scan
+	vector<JoinFilterPushdownColumn> filters;
+
+public:
+	//! Whether or not the keys of the given type can be turned into a range filter
+	static bool SupportsType(const LogicalType &type);
+
+	unique_ptr<JoinFilterGlobalState> GetGlobalState(const vector<LogicalType> &condition_types) const;
+	unique_ptr<JoinFilterLocalState> GetLocalState(const vector<LogicalType> &condition_types) const;
+
+	//! Updates the local min/max with a chunk of build-side keys
+	void Sink(DataChunk &keys, JoinFilterLocalState &lstate) const;
+	//! Merges the local min/max into the global state
+	void Combine(JoinFilterGlobalState &gstate, JoinFilterLocalState &lstate) const;
+	//! Pushes the collected key ranges into the probe-side scan
+	void PushFilters(JoinFilterGlobalState &gstate, const PhysicalOperator &op) const;
+};
+
+} // namespace duckdb
@@ -10,6 +10,7 @@
 
 #include "duckdb/common/value_operations/value_operations.hpp"
 #include "duckdb/execution/join_hashtable.hpp"
+#include "duckdb/execution/operator/join/join_filter_pushdown.hpp"
 #include "duckdb/execution/operator/join/perfect_hash_join_executor.hpp"
 #include "duckdb/execution/operator/join/physical_comparison_join.hpp"
 #include "duckdb/execution/physical_operator.hpp"
@@ -51,6 +52,8 @@ public:
 	vector<LogicalType> delim_types;
 	//! Used in perfect hash join
 	PerfectHashJoinStats perfect_join_statistics;
+	//! (If any) the build-side key ranges that are pushed into the probe-side scan
+	unique_ptr<JoinFilterPushdownInfo> filter_pushdown;
 
 public:
 	string ParamsToString() const override;
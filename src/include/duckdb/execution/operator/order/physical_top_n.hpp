@@ -10,6 +10,7 @@
 
 #include "duckdb/execution/physical_operator.hpp"
 #include "duckdb/planner/bound_query_node.hpp"
+#include "duckdb/planner/table_filter.hpp"
 
 namespace duckdb {
 
@@ -26,6 +27,11 @@ public:
 	vector<BoundOrderByNode> orders;
 	idx_t limit;
 	idx_t offset;
+	//! The dynamic filters of the scan that produces the first ordering column (if any). The boundary value of the
+	//! first ordering column is pushed into this scan, so rows that cannot make it into the top-n are skipped
+	shared_ptr<DynamicTableFilterSet> dynamic_filters;
+	//! The index of the first ordering column in the scan
+	idx_t dynamic_filter_column = DConstants::INVALID_INDEX;
 
 public:
 	// Source interface
@@ -44,6 +44,8 @@ public:
 	unique_ptr<TableFilterSet> table_filters;
 	//! Currently stores any filters applied to file names (as strings)
 	ExtraOperatorInfo extra_info;
+	//! Filters that are pushed into the scan at execution time (e.g. by a hash join)
+	shared_ptr<DynamicTableFilterSet> dynamic_filters;
 
 public:
 	string GetName() const override;
@@ -178,6 +178,8 @@ public:
 	bool IsConstantAggregate();
 	bool IsCustomAggregate();
 	bool IsDistinctAggregate();
+	//! Whether the frames have a constant width that is small enough for sliding aggregation
+	bool IsSlidingAggregate(idx_t &frame_width);
 
 	WindowAggregateExecutor(BoundWindowExpression &wexpr, ClientContext &context, const idx_t payload_count,
 	                        const ValidityMask &partition_mask, const ValidityMask &order_mask,
@@ -152,6 +152,28 @@ public:
 	unique_ptr<WindowAggregatorState> gstate;
 };
 
+//! Sliding aggregator for fixed-width ROWS frames (e.g., ROWS BETWEEN n PRECEDING AND CURRENT ROW).
+//! The rows are split into blocks of the frame width, aligned with the partition start, so every frame is a suffix of
+//! one block followed by a prefix of the next block. The block prefixes and suffixes are computed for each chunk,
+//! so every row takes a constant number of aggregate updates and combines, independent of the frame width.
+//! Frames that do not have this shape (e.g., wider frames) are aggregated directly.
+class WindowSlidingAggregator : public WindowAggregator {
+public:
+	WindowSlidingAggregator(AggregateObject aggr, const LogicalType &result_type, const WindowExcludeMode exclude_mode_p,
+	                        idx_t count, idx_t frame_width);
+	~WindowSlidingAggregator() override;
+
+	unique_ptr<WindowAggregatorState> GetLocalState() const override;
+	void Evaluate(WindowAggregatorState &lstate, const DataChunk &bounds, Vector &result, idx_t count,
+	              idx_t row_idx) const override;
+
+	//! The width of the frames, used as the block size
+	const idx_t frame_width;
+
+	//! The maximum frame width for sliding aggregation, wider frames use a segment tree
+	static constexpr idx_t MAX_FRAME_WIDTH = STANDARD_VECTOR_SIZE;
+};
+
 class WindowSegmentTree : public WindowAggregator {
 
 public:
@@ -27,6 +27,8 @@ class TableFilterSet;
 class TableCatalogEntry;
 struct MultiFileReader;
 
+enum class TableFunctionInitialization : uint8_t { INITIALIZE_ON_EXECUTE, INITIALIZE_ON_SCHEDULE };
+
 struct TableFunctionInfo {
 	DUCKDB_API virtual ~TableFunctionInfo();
 
@@ -296,6 +298,9 @@ public:
 	bool filter_prune;
 	//! Additional function info, passed to the bind
 	shared_ptr<TableFunctionInfo> function_info;
+	//! When the global state of the function is initialized. Functions that have to be initialized from the main
+	//! thread (e.g., because they call into a client) are initialized when the query is scheduled.
+	TableFunctionInitialization global_initialization = TableFunctionInitialization::INITIALIZE_ON_EXECUTE;
 
 	DUCKDB_API bool Equal(const TableFunction &rhs) const;
 };
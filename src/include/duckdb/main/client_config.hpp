@@ -110,6 +110,11 @@ struct ClientConfig {
 	//! Output error messages as structured JSON instead of as a raw string
 	bool errors_as_json = false;
 
+	//! The resource group the queries of this client are executed in (empty = the default group)
+	string resource_group;
+	//! The id of the selected resource group: if the group is dropped and created again, the client does not use it
+	idx_t resource_group_id = 0;
+
 	//! Generic options
 	case_insensitive_map_t<Value> set_variables;
 
@@ -119,6 +119,8 @@ struct DBConfigOptions {
 	AccessMode access_mode = AccessMode::AUTOMATIC;
 	//! Checkpoint when WAL reaches this size (default: 16MB)
 	idx_t checkpoint_wal_size = 1 << 24;
+	//! Whether automatic checkpoints are performed by a background thread instead of by the committing transaction
+	bool background_checkpoint = false;
 	//! Whether or not to use Direct IO, bypassing operating system buffers
 	bool use_direct_io = false;
 	//! Whether extensions should be loaded on start-up
@@ -148,10 +150,15 @@ struct DBConfigOptions {
 	//! The number of external threads that work on DuckDB tasks. Default: 1.
 	//! Must be smaller or equal to maximum_threads.
 	idx_t external_threads = 1;
+	//! Whether to pin the worker threads to the NUMA nodes of the system, and to run the tasks of a query on the
+	//! node of the thread that started it where possible
+	bool numa_affinity = false;
 	//! Whether or not to create and use a temporary directory to store intermediates that do not fit in memory
 	bool use_temporary_directory = true;
 	//! Directory to store temporary structures that do not fit in memory
 	string temporary_directory;
+	//! Whether to compress the blocks that are written to the temporary directory
+	bool temp_file_compression = false;
 	//! Whether or not to invoke filesystem trim on free blocks after checkpoint. This will reclaim
 	//! space for sparse files, on platforms that support it.
 	bool trim_free_blocks = false;
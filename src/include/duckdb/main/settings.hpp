@@ -72,6 +72,16 @@ struct CheckpointThresholdSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct BackgroundCheckpointSetting {
+	static constexpr const char *Name = "background_checkpoint";
+	static constexpr const char *Description =
+	    "Whether automatic checkpoints are performed by a background thread instead of by the committing transaction";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct DebugCheckpointAbort {
 	static constexpr const char *Name = "debug_checkpoint_abort";
 	static constexpr const char *Description =
@@ -519,6 +529,16 @@ struct MaximumTempDirectorySize {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct NumaAffinitySetting {
+	static constexpr const char *Name = "numa_affinity";
+	static constexpr const char *Description = "Whether to pin worker threads to NUMA nodes, and to prefer running "
+	                                           "tasks on the node of the connection that scheduled them";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct OldImplicitCasting {
 	static constexpr const char *Name = "old_implicit_casting";
 	static constexpr const char *Description = "Allow implicit casting to/from VARCHAR";
@@ -625,6 +645,16 @@ struct ProgressBarTimeSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct ResourceGroupSetting {
+	static constexpr const char *Name = "resource_group";
+	static constexpr const char *Description =
+	    "The resource group in which the queries of this connection are executed (see PRAGMA create_resource_group)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct SchemaSetting {
 	static constexpr const char *Name = "schema";
 	static constexpr const char *Description =
@@ -663,6 +693,16 @@ struct TempDirectorySetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct TempFileCompressionSetting {
+	static constexpr const char *Name = "temp_file_compression";
+	static constexpr const char *Description =
+	    "Whether to compress the blocks that are written to the temp directory with LZ4";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct ThreadsSetting {
 	static constexpr const char *Name = "threads";
 	static constexpr const char *Description = "The number of total threads used by the system.";
@@ -79,9 +79,13 @@ public:
 
 	void Compress(unique_ptr<LogicalOperator> &op);
 
+	//! The minimum estimated cardinality of the build side of a join for it to be compressed
+	static constexpr const idx_t JOIN_BUILD_COMPRESSION_THRESHOLD = 1048576;
+
 private:
 	//! Compress materializing operators
 	void CompressAggregate(unique_ptr<LogicalOperator> &op);
+	void CompressComparisonJoin(unique_ptr<LogicalOperator> &op);
 	void CompressDistinct(unique_ptr<LogicalOperator> &op);
 	void CompressOrder(unique_ptr<LogicalOperator> &op);
 
@@ -0,0 +1,45 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/join_filter_pushdown_optimizer.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/optional_ptr.hpp"
+#include "duckdb/planner/column_binding.hpp"
+#include "duckdb/planner/logical_operator_visitor.hpp"
+
+namespace duckdb {
+class ClientContext;
+class LogicalComparisonJoin;
+class LogicalGet;
+class LogicalTopN;
+
+//! The JoinFilterPushdownOptimizer links hash joins to the table scans on their probe side, so that the min/max of the
+//! build-side keys can be pushed into the scan as dynamic filters at execution time. Top-N operators are linked to the
+//! scan of their first ordering column in the same manner, so their boundary value can be pushed into the scan.
+class JoinFilterPushdownOptimizer : public LogicalOperatorVisitor {
+public:
+	explicit JoinFilterPushdownOptimizer(ClientContext &context) : context(context) {
+	}
+
+	void VisitOperator(LogicalOperator &op) override;
+
+private:
+	void GenerateJoinFilters(LogicalComparisonJoin &join);
+	void GenerateTopNFilters(LogicalTopN &top_n);
+	//! Whether or not the join is planned as a hash join (see PhysicalPlanGenerator::PlanComparisonJoin)
+	bool IsHashJoin(LogicalComparisonJoin &join);
+	//! Whether or not dynamic filters can be pushed into the given column of the scan
+	static bool CanPushdownFilters(LogicalGet &get, const ColumnBinding &binding);
+	//! Follows the binding down through the operators that are executed in the same pipeline as the operator,
+	//! returns the scan that produces the column (if any)
+	optional_ptr<LogicalGet> FindProbeScan(LogicalOperator &op, ColumnBinding &binding);
+
+	ClientContext &context;
+};
+
+} // namespace duckdb
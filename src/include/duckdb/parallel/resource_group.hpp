@@ -0,0 +1,60 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/parallel/resource_group.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/common.hpp"
+
+namespace duckdb {
+
+//! A ResourceGroup is a named class of queries that share a priority, a share of the scheduler threads, and a limit
+//! on the temporary memory they may reserve. Connections select a group with the "resource_group" setting.
+//! Groups are created with PRAGMA create_resource_group, and are owned by the TaskScheduler
+class ResourceGroup {
+public:
+	explicit ResourceGroup(idx_t index);
+
+	//! The name of the default resource group, which cannot be dropped
+	static constexpr const char *DEFAULT_GROUP = "default";
+
+	//! The index of the resource group in the TaskScheduler
+	const idx_t index;
+	//! The name of the resource group (protected by the TaskScheduler, as the index can be re-used after a drop)
+	string name;
+	//! The unique id of the resource group, which is not re-used when a group with the same name is created again
+	atomic<idx_t> id;
+	//! Whether or not the group was dropped (protected by the TaskScheduler)
+	bool dropped;
+	//! The tasks of groups with a higher priority are executed first (modified through the TaskScheduler)
+	atomic<int64_t> priority;
+	//! The share (0, 1] of the threads that may execute tasks of this group while other groups have tasks
+	atomic<double> thread_share;
+	//! The maximum temporary memory reserved by the queries in this group
+	atomic<idx_t> memory_limit;
+	//! The number of threads currently executing tasks of this group
+	atomic<idx_t> active_threads;
+	//! The number of producers (i.e., running queries) that schedule tasks in this group
+	atomic<idx_t> active_producers;
+	//! The temporary memory currently reserved by the queries in this group (protected by the TemporaryMemoryManager)
+	idx_t reservation;
+
+public:
+	//! (Re-)initializes the group under a new name and id, with the default settings
+	void Initialize(string name, idx_t id);
+	//! Resets the priority, thread share and memory limit to the defaults
+	void SetDefaults();
+	//! Returns the maximum number of threads executing tasks of this group while other groups have tasks
+	idx_t MaximumThreads(idx_t thread_count) const;
+	//! Whether the group limits the temporary memory of its queries
+	bool HasMemoryLimit() const;
+	//! Whether the group was dropped and is no longer used by any query, so its index can be re-used
+	bool IsUnused() const;
+};
+
+} // namespace duckdb
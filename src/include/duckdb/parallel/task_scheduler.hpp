@@ -9,7 +9,9 @@
 #pragma once
 
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/case_insensitive_map.hpp"
 #include "duckdb/common/mutex.hpp"
+#include "duckdb/common/optional_ptr.hpp"
 #include "duckdb/common/vector.hpp"
 #include "duckdb/parallel/task.hpp"
 #include "duckdb/common/atomic.hpp"
@@ -20,23 +22,28 @@ struct ConcurrentQueue;
 struct QueueProducerToken;
 class ClientContext;
 class DatabaseInstance;
+class ResourceGroup;
 class TaskScheduler;
 
 struct SchedulerThread;
 
 struct ProducerToken {
-	ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token);
+	ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token, ResourceGroup &resource_group);
 	~ProducerToken();
 
 	TaskScheduler &scheduler;
 	unique_ptr<QueueProducerToken> token;
 	mutex producer_lock;
+	//! The resource group the tasks of this producer are executed in
+	ResourceGroup &resource_group;
 };
 
 //! The TaskScheduler is responsible for managing tasks and threads
 class TaskScheduler {
 	// timeout for semaphore wait, default 5ms
 	constexpr static int64_t TASK_TIMEOUT_USECS = 5000;
+	// the maximum amount of resource groups that can exist at the same time (including recently dropped groups)
+	constexpr static idx_t MAXIMUM_RESOURCE_GROUPS = 64;
 
 public:
 	explicit TaskScheduler(DatabaseInstance &db);
@@ -45,13 +52,18 @@ public:
 	DUCKDB_API static TaskScheduler &GetScheduler(ClientContext &context);
 	DUCKDB_API static TaskScheduler &GetScheduler(DatabaseInstance &db);
 
+	//! Creates a producer, whose tasks are scheduled on the NUMA node of the calling thread
 	unique_ptr<ProducerToken> CreateProducer();
+	//! Creates a producer, whose tasks are executed with the priority and thread share of the given resource group
+	unique_ptr<ProducerToken> CreateProducer(ResourceGroup &group);
 	//! Schedule a task to be executed by the task scheduler
 	void ScheduleTask(ProducerToken &producer, shared_ptr<Task> task);
 	//! Fetches a task from a specific producer, returns true if successful or false if no tasks were available
 	bool GetTaskFromProducer(ProducerToken &token, shared_ptr<Task> &task);
 	//! Run tasks forever until "marker" is set to false, "marker" must remain valid until the thread is joined
 	void ExecuteForever(atomic<bool> *marker);
+	//! Run tasks forever on the given NUMA node, stealing tasks from other nodes only if the node has no tasks
+	void ExecuteForever(atomic<bool> *marker, idx_t node);
 	//! Run tasks until `marker` is set to false, `max_tasks` have been completed, or until there are no more tasks
 	//! available. Returns the number of tasks that were completed.
 	idx_t ExecuteTasks(atomic<bool> *marker, idx_t max_tasks);
@@ -77,13 +89,52 @@ public:
 	//! Set the allocator flush threshold
 	void SetAllocatorFlushTreshold(idx_t threshold);
 
+	//! Returns the number of NUMA nodes the scheduler distributes its tasks and threads over
+	idx_t NumberOfNodes() const;
+
+	//! Creates a resource group with the default settings, or resets the settings of an existing group
+	DUCKDB_API ResourceGroup &CreateResourceGroup(const string &name);
+	//! Sets the priority of a resource group
+	DUCKDB_API void SetResourceGroupPriority(ResourceGroup &group, int64_t priority);
+	//! Drops a resource group, the queries that use it fall back to the default group
+	DUCKDB_API void DropResourceGroup(const string &name);
+	//! Returns the resource group with the given name, or nullptr if it does not exist
+	DUCKDB_API optional_ptr<ResourceGroup> GetResourceGroup(const string &name);
+	//! Returns the resource group selected by the client, or the default group if it was dropped in the meantime
+	DUCKDB_API ResourceGroup &GetResourceGroup(const ClientContext &context);
+
 private:
 	void RelaunchThreadsInternal(int32_t n);
+	//! Returns the NUMA node of the CPU the calling thread is currently running on
+	idx_t GetCurrentNode() const;
+	//! Dequeues a task to execute: from the highest-priority group that has not used up its thread share if possible
+	bool DequeueTask(idx_t node, shared_ptr<Task> &task, optional_ptr<ResourceGroup> &group);
+	//! Sorts the resource groups that were not dropped by priority (must hold the resource group lock)
+	void UpdateResourceGroupOrder();
 
 private:
 	DatabaseInstance &db;
 	//! The task queue
 	unique_ptr<ConcurrentQueue> queue;
+	//! The CPUs of each NUMA node (if "numa_affinity" is enabled), or a single node without CPU affinity
+	vector<vector<idx_t>> node_cpus;
+	//! The NUMA node of each CPU
+	vector<idx_t> cpu_nodes;
+	//! Lock for creating and dropping resource groups
+	mutex resource_group_lock;
+	//! The resource groups, which are never destroyed so that the tasks of dropped groups can still run
+	//! The index of a dropped group is re-used by a new group once the dropped group is no longer in use
+	vector<unique_ptr<ResourceGroup>> resource_groups;
+	//! The number of resource group indexes that are in use
+	atomic<idx_t> resource_group_count;
+	//! The index of the resource groups that were not dropped, by name
+	case_insensitive_map_t<idx_t> resource_group_map;
+	//! The id of the next resource group that is created
+	idx_t next_resource_group_id;
+	//! The indexes of the resource groups that were not dropped, ordered by priority (highest first)
+	atomic<idx_t> resource_group_order[MAXIMUM_RESOURCE_GROUPS];
+	//! The number of entries in resource_group_order
+	atomic<idx_t> resource_group_order_count;
 	//! Lock for modifying the thread count
 	mutex thread_lock;
 	//! The active background threads of the task scheduler
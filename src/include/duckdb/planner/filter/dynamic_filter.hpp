@@ -0,0 +1,56 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/dynamic_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/common/mutex.hpp"
+
+namespace duckdb {
+
+//! The data of a dynamic filter, shared between the operator that updates the filter and the scans that evaluate it.
+//! Every update publishes a new, immutable filter, so scans can load the current filter without taking a lock.
+struct DynamicFilterData {
+public:
+	//! Returns the current filter, or nullptr if the filter has not been set yet
+	shared_ptr<ConstantFilter> GetFilter() const;
+	//! Sets the constant of the filter, or tightens it if the filter was already set
+	void SetValue(ExpressionType comparison_type, Value val);
+	void Reset();
+
+private:
+	//! Serializes the updates of the filter
+	mutex lock;
+	//! The current filter (if set). Only accessed through std::atomic_load and std::atomic_store
+	std::shared_ptr<ConstantFilter> filter;
+};
+
+//! DynamicFilter is a filter whose constant changes while the scan is running (e.g. the boundary value of a Top-N).
+//! Before the filter has been set, it does not filter anything.
+class DynamicFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::DYNAMIC_FILTER;
+
+public:
+	DynamicFilter();
+	explicit DynamicFilter(shared_ptr<DynamicFilterData> filter_data);
+
+	//! The shared, dynamic filter data
+	shared_ptr<DynamicFilterData> filter_data;
+
+public:
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	unique_ptr<TableFilter> Copy() const override;
+	bool Equals(const TableFilter &other) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+};
+
+} // namespace duckdb
@@ -15,6 +15,7 @@
 #include "duckdb/planner/operator/logical_join.hpp"
 
 namespace duckdb {
+struct JoinFilterPushdownInfo;
 
 //! LogicalComparisonJoin represents a join that involves comparisons between the LHS and RHS
 class LogicalComparisonJoin : public LogicalJoin {
@@ -24,6 +25,7 @@ public:
 public:
 	explicit LogicalComparisonJoin(JoinType type,
 	                               LogicalOperatorType logical_type = LogicalOperatorType::LOGICAL_COMPARISON_JOIN);
+	~LogicalComparisonJoin() override;
 
 	//! The conditions of the join
 	vector<JoinCondition> conditions;
@@ -33,6 +35,8 @@ public:
 	vector<unique_ptr<Expression>> duplicate_eliminated_columns;
 	//! If this is a DelimJoin, whether it has been flipped to de-duplicating the RHS instead
 	bool delim_flipped = false;
+	//! (If any) the build-side key ranges that are pushed into the probe-side scan at execution time
+	unique_ptr<JoinFilterPushdownInfo> filter_pushdown;
 
 public:
 	string ParamsToString() const override;
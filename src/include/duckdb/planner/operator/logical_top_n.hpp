@@ -10,6 +10,7 @@
 
 #include "duckdb/planner/bound_query_node.hpp"
 #include "duckdb/planner/logical_operator.hpp"
+#include "duckdb/planner/table_filter.hpp"
 
 namespace duckdb {
 
@@ -28,6 +29,10 @@ public:
 	idx_t limit;
 	//! The offset from the start to begin emitting elements
 	idx_t offset;
+	//! The dynamic filters of the scan that produces the first ordering column (if any)
+	shared_ptr<DynamicTableFilterSet> dynamic_filters;
+	//! The index of the first ordering column in the scan
+	idx_t dynamic_filter_column = DConstants::INVALID_INDEX;
 
 public:
 	vector<ColumnBinding> GetColumnBindings() override {
@@ -11,10 +11,14 @@
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/types.hpp"
 #include "duckdb/common/unordered_map.hpp"
+#include "duckdb/common/reference_map.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/optional_ptr.hpp"
 #include "duckdb/common/enums/filter_propagate_result.hpp"
 
 namespace duckdb {
 class BaseStatistics;
+class PhysicalOperator;
 
 enum class TableFilterType : uint8_t {
 	CONSTANT_COMPARISON = 0, // constant comparison (e.g. =C, >C, >=C, <C, <=C)
@@ -22,7 +26,8 @@ enum class TableFilterType : uint8_t {
 	IS_NOT_NULL = 2,
 	CONJUNCTION_OR = 3,
 	CONJUNCTION_AND = 4,
-	STRUCT_EXTRACT = 5
+	STRUCT_EXTRACT = 5,
+	DYNAMIC_FILTER = 6 // dynamic filter whose constant is updated during execution (e.g. by a Top-N)
 };
 
 //! TableFilter represents a filter pushed down into the table scan.
@@ -39,6 +44,7 @@ public:
 	//! Returns true if the statistics indicate that the segment can contain values that satisfy that filter
 	virtual FilterPropagateResult CheckStatistics(BaseStatistics &stats) = 0;
 	virtual string ToString(const string &column_name) = 0;
+	virtual unique_ptr<TableFilter> Copy() const;
 	virtual bool Equals(const TableFilter &other) const {
 		return filter_type != other.filter_type;
 	}
@@ -100,4 +106,22 @@ public:
 	static TableFilterSet Deserialize(Deserializer &deserializer);
 };
 
+//! DynamicTableFilterSet holds filters that are only known at execution time (e.g. derived from the build side of a
+//! hash join), and are pushed into a table scan before the scan is initialized
+class DynamicTableFilterSet {
+public:
+	//! Removes all filters that were pushed by the given operator
+	void ClearFilters(const PhysicalOperator &op);
+	//! Pushes a filter on the given column of the scan, on behalf of the given operator
+	void PushFilter(const PhysicalOperator &op, idx_t column_index, unique_ptr<TableFilter> filter);
+
+	bool HasFilters() const;
+	//! Combines the static filters of the scan with the dynamic filters into a single filter set
+	unique_ptr<TableFilterSet> GetFinalTableFilters(optional_ptr<TableFilterSet> existing_filters) const;
+
+private:
+	mutable mutex lock;
+	reference_map_t<const PhysicalOperator, unique_ptr<TableFilterSet>> filters;
+};
+
 } // namespace duckdb
@@ -13,7 +13,10 @@ struct MemoryInformation {
 
 struct TemporaryFileInformation {
 	string path;
+	//! The size of the file on disk
 	idx_t size;
+	//! The size of the blocks stored in the file before compression
+	idx_t uncompressed_size;
 };
 
 } // namespace duckdb
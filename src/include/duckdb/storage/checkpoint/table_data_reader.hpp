@@ -11,18 +11,19 @@
 #include "duckdb/storage/checkpoint_manager.hpp"
 
 namespace duckdb {
-struct BoundCreateTableInfo;
+class PersistentTableData;
 
 //! The table data reader is responsible for reading the data of a table from the block manager
 class TableDataReader {
 public:
-	TableDataReader(MetadataReader &reader, BoundCreateTableInfo &info);
+	TableDataReader(MetadataReader &reader, const vector<LogicalType> &types, PersistentTableData &data);
 
 	void ReadTableData();
 
 private:
 	MetadataReader &reader;
-	BoundCreateTableInfo &info;
+	const vector<LogicalType> &types;
+	PersistentTableData &data;
 };
 
 } // namespace duckdb
@@ -63,6 +63,8 @@ struct RowGroupPointer {
 	vector<MetaBlockPointer> data_pointers;
 	//! Data pointers to the delete information of the row group (if any)
 	vector<MetaBlockPointer> deletes_pointers;
+	//! The metadata blocks that hold the column metadata of the row group (empty if unknown)
+	vector<MetaBlockPointer> metadata_blocks;
 };
 
 } // namespace duckdb
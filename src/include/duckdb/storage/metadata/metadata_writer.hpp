@@ -30,6 +30,8 @@ public:
 	MetadataManager &GetManager() {
 		return manager;
 	}
+	//! Sets the list in which the pointers of newly allocated metadata blocks are recorded (or nullptr to stop)
+	void SetWrittenPointers(optional_ptr<vector<MetaBlockPointer>> written_pointers);
 
 protected:
 	virtual MetadataHandle NextHandle();
@@ -31,8 +31,12 @@ public:
 	virtual ~StorageCommitState() {
 	}
 
-	// Make the commit persistent
+	// Write the commit to persistent storage
 	virtual void FlushCommit() = 0;
+	// Wait until the commit written by FlushCommit is durable
+	// This can be called without holding the transaction lock, so that concurrent commits can share a single sync
+	virtual void SyncCommit() {
+	}
 };
 
 struct CheckpointOptions {
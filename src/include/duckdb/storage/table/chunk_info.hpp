@@ -11,6 +11,7 @@
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/vector_size.hpp"
 #include "duckdb/common/atomic.hpp"
+#include "duckdb/common/types/validity_mask.hpp"
 
 namespace duckdb {
 class RowGroup;
@@ -113,6 +114,12 @@ public:
 	//! The transaction ids of the transactions that deleted the tuples (if any)
 	transaction_t deleted[STANDARD_VECTOR_SIZE];
 	bool any_deleted;
+	//! Bitmap of the tuples of which the delete has been committed (bit set = deleted)
+	validity_t committed_deletes[ValidityMask::STANDARD_ENTRY_COUNT];
+	//! The highest commit id of the committed deletes
+	transaction_t max_committed_delete_id;
+	//! The number of deletes that have not been committed yet
+	idx_t uncommitted_delete_count;
 
 public:
 	idx_t GetSelVector(transaction_t start_time, transaction_t transaction_id, SelectionVector &sel_vector,
@@ -143,6 +150,15 @@ private:
 	template <class OP>
 	idx_t TemplatedGetSelVector(transaction_t start_time, transaction_t transaction_id, SelectionVector &sel_vector,
 	                            idx_t max_count) const;
+	//! Whether or not the visibility of all deleted tuples is given by the committed_deletes bitmap for a transaction
+	template <class OP>
+	bool DeletesAreCommitted(transaction_t start_time, transaction_t transaction_id) const;
+	//! Fills the selection vector with all tuples that are not marked in the committed_deletes bitmap
+	idx_t GetCommittedDeletesSelVector(SelectionVector &sel_vector, idx_t max_count) const;
+	bool IsCommittedDelete(idx_t row) const {
+		return committed_deletes[row / ValidityMask::BITS_PER_VALUE] &
+		       (validity_t(1) << (row % ValidityMask::BITS_PER_VALUE));
+	}
 };
 
 } // namespace duckdb
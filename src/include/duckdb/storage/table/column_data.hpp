@@ -85,6 +85,11 @@ public:
 	const LogicalType &RootType() const;
 	//! Whether or not the column has any updates
 	bool HasUpdates() const;
+	//! Whether or not any of the rows in the range [start_row, end_row] (relative to the start of the column) have
+	//! been updated
+	bool HasUpdates(idx_t start_row, idx_t end_row) const;
+	//! Whether or not the column has changes (appends or updates) that have not been written to disk yet
+	virtual bool HasChanges();
 	//! Whether or not we can scan an entire vector
 	virtual ScanVectorType GetVectorScanType(ColumnScanState &state, idx_t scan_count);
 
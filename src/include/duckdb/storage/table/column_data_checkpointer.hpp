@@ -11,11 +11,22 @@
 #include "duckdb/storage/table/column_data.hpp"
 #include "duckdb/function/compression_function.hpp"
 #include "duckdb/storage/table/column_checkpoint_state.hpp"
+#include "duckdb/storage/table/data_table_info.hpp"
 
 namespace duckdb {
 struct TableScanOptions;
 
 class ColumnDataCheckpointer {
+public:
+	//! Columns with more vectors than this are first analyzed on a sample of their vectors
+	static constexpr const idx_t ANALYSIS_SAMPLE_THRESHOLD = 16;
+	//! Every ANALYSIS_SAMPLE_INTERVAL-th vector is part of the sample
+	static constexpr const idx_t ANALYSIS_SAMPLE_INTERVAL = 4;
+	//! The compression method of the previous checkpoint is reused if its score per row changed by less than this factor
+	static constexpr const double CACHED_COMPRESSION_TOLERANCE = 1.25;
+	//! After this many reuses of the compression method of the previous checkpoint, all methods are analyzed again
+	static constexpr const idx_t CACHED_COMPRESSION_MAX_REUSE = 8;
+
 public:
 	ColumnDataCheckpointer(ColumnData &col_data_p, RowGroup &row_group_p, ColumnCheckpointState &state_p,
 	                       ColumnCheckpointInfo &checkpoint_info);
@@ -31,7 +42,18 @@ public:
 	CompressionFunction &GetCompressionFunction(CompressionType type);
 
 private:
-	void ScanSegments(const std::function<void(Vector &, idx_t)> &callback);
+	//! Scans every sample_interval-th vector of the column
+	void ScanSegments(const std::function<void(Vector &, idx_t)> &callback, idx_t sample_interval = 1);
+	idx_t GetRowCount() const;
+	vector<idx_t> GetColumnPath() const;
+	//! Analyzes the candidate compression methods and returns the analyze state of the best one
+	unique_ptr<AnalyzeState> AnalyzeCompressionMethods(vector<optional_ptr<CompressionFunction>> &candidates,
+	                                                   CompressionType forced_method, idx_t sample_interval,
+	                                                   idx_t &compression_idx, idx_t &best_score);
+	//! Analyzes all vectors with a single compression method
+	unique_ptr<AnalyzeState> AnalyzeCompressionMethod(idx_t compression_idx, idx_t &score);
+	unique_ptr<AnalyzeState> AnalyzeCachedCompressionMethod(const CachedCompressionMethod &cached,
+	                                                         idx_t &compression_idx);
 	unique_ptr<AnalyzeState> DetectBestCompressionMethod(idx_t &compression_idx);
 	void WriteToDisk();
 	bool HasChanges();
@@ -10,6 +10,8 @@
 
 #include "duckdb/common/atomic.hpp"
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/enums/compression_type.hpp"
+#include "duckdb/common/map.hpp"
 #include "duckdb/storage/table/table_index_list.hpp"
 #include "duckdb/storage/storage_lock.hpp"
 
@@ -17,6 +19,18 @@ namespace duckdb {
 class DatabaseInstance;
 class TableIOManager;
 
+//! The compression method that was chosen for a column at a previous checkpoint
+struct CachedCompressionMethod {
+	//! The compression method
+	CompressionType type;
+	//! The physical type of the column
+	PhysicalType physical_type;
+	//! The analyze score of the compression method per row
+	double score_per_row;
+	//! How often the compression method was reused without analyzing the other compression methods
+	idx_t reuse_count;
+};
+
 struct DataTableInfo {
 	friend class DataTable;
 
@@ -49,6 +63,11 @@ public:
 	string GetTableName();
 	void SetTableName(string name);
 
+	//! Looks up the compression method that was chosen for a column at a previous checkpoint. Nested columns are
+	//! identified by the column indexes on the path from the top-level column.
+	bool GetCachedCompression(const vector<idx_t> &column_path, CachedCompressionMethod &result);
+	void SetCachedCompression(const vector<idx_t> &column_path, const CachedCompressionMethod &method);
+
 private:
 	//! The database instance of the table
 	AttachedDatabase &db;
@@ -66,6 +85,10 @@ private:
 	vector<IndexStorageInfo> index_storage_infos;
 	//! Lock held while checkpointing
 	StorageLock checkpoint_lock;
+	//! Lock for the compression cache, row groups can be checkpointed in parallel
+	mutex compression_cache_lock;
+	//! The compression method that was chosen for every column at its last checkpoint
+	map<vector<idx_t>, CachedCompressionMethod> compression_cache;
 };
 
 } // namespace duckdb
@@ -26,6 +26,9 @@ public:
 	idx_t total_rows;
 	idx_t row_group_count;
 	MetaBlockPointer block_pointer;
+	//! If set, the statistics and row group pointers have not been read yet - they are read from this pointer when
+	//! the table data is first accessed
+	MetaBlockPointer table_pointer;
 };
 
 } // namespace duckdb
@@ -58,6 +58,8 @@ struct RowGroupWriteInfo {
 struct RowGroupWriteData {
 	vector<unique_ptr<ColumnCheckpointState>> states;
 	vector<BaseStatistics> statistics;
+	//! Whether the row group is unchanged since it was last written, in which case its metadata is re-used as-is
+	bool reuse_existing_metadata = false;
 };
 
 class RowGroup : public SegmentBase<RowGroup> {
@@ -133,6 +135,8 @@ public:
 	//! Returns the number of committed rows (count - committed deletes)
 	idx_t GetCommittedRowCount();
 	RowGroupWriteData WriteToDisk(RowGroupWriter &writer);
+	//! Returns whether or not the row group has been modified since it was last written to disk
+	bool HasChanges();
 	RowGroupPointer Checkpoint(RowGroupWriteData write_data, RowGroupWriter &writer, TableStatistics &global_stats);
 
 	void InitializeAppend(RowGroupAppendState &append_state);
@@ -184,6 +188,8 @@ private:
 private:
 	mutex row_group_lock;
 	vector<MetaBlockPointer> column_pointers;
+	//! The metadata blocks that hold the column metadata of all columns (empty if unknown)
+	vector<MetaBlockPointer> column_metadata_blocks;
 	unique_ptr<atomic<bool>[]> is_loaded;
 	vector<MetaBlockPointer> deletes_pointers;
 	atomic<bool> deletes_is_loaded;
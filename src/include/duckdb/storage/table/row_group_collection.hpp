@@ -43,6 +43,8 @@ public:
 
 	void Initialize(PersistentTableData &data);
 	void InitializeEmpty();
+	//! Reads the statistics and row group pointers of the table, if their loading was deferred in Initialize
+	void LoadTableData();
 
 	bool IsEmpty() const;
 
@@ -144,6 +146,12 @@ private:
 	TableStatistics stats;
 	//! Allocation size, only tracked for appends
 	idx_t allocation_size;
+	//! Whether or not the statistics and row group pointers of the table have been read
+	atomic<bool> table_data_loaded;
+	//! Pointer to the statistics and row group pointers of the table, if they have not been read yet
+	MetaBlockPointer table_pointer;
+	//! Lock held while loading the table data
+	mutex load_lock;
 };
 
 } // namespace duckdb
@@ -22,6 +22,8 @@ public:
 	~RowGroupSegmentTree() override;
 
 	void Initialize(PersistentTableData &data);
+	//! Initialize the tree for a collection of which the row group pointers are read lazily
+	void InitializeLazy();
 
 protected:
 	unique_ptr<RowGroup> LoadSegment() override;
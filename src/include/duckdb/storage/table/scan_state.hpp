@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/profiler.hpp"
 #include "duckdb/storage/buffer/buffer_handle.hpp"
 #include "duckdb/storage/storage_lock.hpp"
 #include "duckdb/common/enums/scan_options.hpp"
@@ -127,6 +128,10 @@ public:
 	idx_t max_row;
 	//! The current batch index
 	idx_t batch_index;
+	//! The number of vectors in the morsel of a parallel scan that is being scanned (0 if none)
+	idx_t morsel_vector_count;
+	//! Measures the time spent on the current morsel of a parallel scan
+	Profiler morsel_timer;
 
 public:
 	void Initialize(const vector<LogicalType> &types);
@@ -179,6 +184,12 @@ private:
 struct ParallelCollectionScanState {
 	ParallelCollectionScanState();
 
+	//! The target time spent on a single morsel, the morsel size is adapted to reach it
+	static constexpr const double TARGET_MORSEL_SECONDS = 0.002;
+	//! The minimum and maximum number of vectors in a morsel
+	static constexpr const idx_t MINIMUM_MORSEL_VECTOR_COUNT = 1;
+	static constexpr const idx_t MAXIMUM_MORSEL_VECTOR_COUNT = 8 * Storage::ROW_GROUP_VECTOR_COUNT;
+
 	//! The row group collection we are scanning
 	RowGroupCollection *collection;
 	RowGroup *current_row_group;
@@ -186,6 +197,8 @@ struct ParallelCollectionScanState {
 	idx_t max_row;
 	idx_t batch_index;
 	atomic<idx_t> processed_rows;
+	//! The number of vectors handed out per morsel, adapted to the observed time per morsel
+	idx_t morsel_vector_count;
 	mutex lock;
 };
 
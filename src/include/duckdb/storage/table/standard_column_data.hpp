@@ -24,6 +24,7 @@ public:
 
 public:
 	void SetStart(idx_t new_start) override;
+	bool HasChanges() override;
 	bool CheckZonemap(ColumnScanState &state, TableFilter &filter) override;
 
 	ScanVectorType GetVectorScanType(ColumnScanState &state, idx_t scan_count) override;
@@ -26,6 +26,7 @@ public:
 
 public:
 	void SetStart(idx_t new_start) override;
+	bool HasChanges() override;
 	bool CheckZonemap(ColumnScanState &state, TableFilter &filter) override;
 	idx_t GetMaxEntry() override;
 
@@ -54,7 +54,7 @@ public:
 	unique_ptr<TableStatisticsLock> GetLock();
 
 	void Serialize(Serializer &serializer) const;
-	void Deserialize(Deserializer &deserializer, ColumnList &columns);
+	void Deserialize(Deserializer &deserializer, const vector<LogicalType> &types);
 
 private:
 	//! The statistics lock
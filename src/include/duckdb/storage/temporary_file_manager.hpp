@@ -27,7 +27,7 @@ class TemporaryFileManager;
 
 struct BlockIndexManager {
 public:
-	explicit BlockIndexManager(TemporaryFileManager &manager);
+	BlockIndexManager(TemporaryFileManager &manager, idx_t block_size);
 	BlockIndexManager();
 
 public:
@@ -37,6 +37,8 @@ public:
 	//! Returns true if the max_index has been altered
 	bool RemoveIndex(idx_t index);
 	idx_t GetMaxIndex();
+	//! Returns the number of indexes that are in use
+	idx_t GetIndexCount();
 	bool HasFreeBlocks();
 
 private:
@@ -48,6 +50,8 @@ private:
 	set<idx_t> free_indexes;
 	set<idx_t> indexes_in_use;
 	optional_ptr<TemporaryFileManager> manager;
+	//! The size of a block on disk
+	idx_t block_size;
 };
 
 //===--------------------------------------------------------------------===//
@@ -70,12 +74,17 @@ public:
 // TemporaryFileHandle
 //===--------------------------------------------------------------------===//
 
+//! A TemporaryFileHandle stores blocks in slots of a fixed size. Files with the default slot size store blocks
+//! uncompressed, files with a smaller slot size store compressed blocks that fit in the slot
 class TemporaryFileHandle {
 	constexpr static idx_t MAX_ALLOWED_INDEX_BASE = 4000;
 
 public:
 	TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory, idx_t index,
-	                    TemporaryFileManager &manager);
+	                    idx_t slot_size, TemporaryFileManager &manager);
+
+	//! The size of the slots of compressed blocks is a multiple of this
+	constexpr static idx_t COMPRESSED_SLOT_GRANULARITY = Storage::BLOCK_ALLOC_SIZE / 8;
 
 public:
 	struct TemporaryFileLock {
@@ -88,11 +97,14 @@ public:
 
 public:
 	TemporaryFileIndex TryGetBlockIndex();
-	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index);
+	//! Writes the buffer to the file, or the compressed buffer if the slots of this file are compressed
+	void WriteTemporaryFile(FileBuffer &buffer, AllocatedData &compressed_buffer, TemporaryFileIndex index);
 	unique_ptr<FileBuffer> ReadTemporaryBuffer(idx_t block_index, unique_ptr<FileBuffer> reusable_buffer);
 	void EraseBlockIndex(block_id_t block_index);
 	bool DeleteIfEmpty();
 	TemporaryFileInformation GetTemporaryFile();
+	idx_t GetSlotSize() const;
+	bool IsCompressed() const;
 
 private:
 	void CreateFileIfNotExists(TemporaryFileLock &);
@@ -104,6 +116,8 @@ private:
 	DatabaseInstance &db;
 	unique_ptr<FileHandle> handle;
 	idx_t file_index;
+	//! The size of the slots in this file
+	const idx_t slot_size;
 	string path;
 	mutex file_lock;
 	BlockIndexManager index_manager;
@@ -159,6 +173,8 @@ public:
 	void DecreaseSizeOnDisk(idx_t amount);
 
 private:
+	//! Compresses the buffer if temp file compression is enabled, and returns the size of the slot to write it to
+	idx_t CompressBuffer(FileBuffer &buffer, AllocatedData &compressed_buffer);
 	void EraseUsedBlock(TemporaryManagerLock &lock, block_id_t id, TemporaryFileHandle *handle,
 	                    TemporaryFileIndex index);
 	TemporaryFileHandle *GetFileHandle(TemporaryManagerLock &, idx_t index);
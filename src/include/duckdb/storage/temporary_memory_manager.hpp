@@ -10,12 +10,14 @@
 
 #include "duckdb/common/atomic.hpp"
 #include "duckdb/common/mutex.hpp"
+#include "duckdb/common/optional_ptr.hpp"
 #include "duckdb/common/reference_map.hpp"
 #include "duckdb/storage/storage_info.hpp"
 
 namespace duckdb {
 
 class ClientContext;
+class ResourceGroup;
 class TemporaryMemoryManager;
 
 //! State of the temporary memory to be managed concurrently with other states
@@ -24,7 +26,8 @@ class TemporaryMemoryState {
 	friend class TemporaryMemoryManager;
 
 private:
-	TemporaryMemoryState(TemporaryMemoryManager &temporary_memory_manager, idx_t minimum_reservation);
+	TemporaryMemoryState(TemporaryMemoryManager &temporary_memory_manager, ResourceGroup &resource_group,
+	                     idx_t minimum_reservation);
 
 public:
 	~TemporaryMemoryState();
@@ -42,6 +45,8 @@ public:
 private:
 	//! The TemporaryMemoryManager that owns this state
 	TemporaryMemoryManager &temporary_memory_manager;
+	//! The resource group of the query this state belongs to
+	ResourceGroup &resource_group;
 
 	//! The remaining size needed if it could fit fully in memory
 	atomic<idx_t> remaining_size;
@@ -86,6 +91,10 @@ private:
 	void UpdateConfiguration(ClientContext &context);
 	//! Update the TemporaryMemoryState to the new remaining size, and updates the reservation (must hold the lock)
 	void UpdateState(ClientContext &context, TemporaryMemoryState &temporary_memory_state);
+	//! Get the memory that the resource group of a TemporaryMemoryState can still reserve for it (must hold the lock)
+	idx_t GetResourceGroupFreeMemory(const TemporaryMemoryState &temporary_memory_state) const;
+	//! Get the minimum reservation of a TemporaryMemoryState within its resource group limit (must hold the lock)
+	idx_t GetMinimumReservation(const TemporaryMemoryState &temporary_memory_state) const;
 	//! Set the remaining size of a TemporaryMemoryState (must hold the lock)
 	void SetRemainingSize(TemporaryMemoryState &temporary_memory_state, idx_t new_remaining_size);
 	//! Set the reservation of a TemporaryMemoryState (must hold the lock)
@@ -14,12 +14,15 @@
 #include "duckdb/catalog/catalog_entry/table_macro_catalog_entry.hpp"
 #include "duckdb/common/enums/wal_type.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/common/serializer/buffered_file_writer.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/storage/block.hpp"
 #include "duckdb/storage/storage_info.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 
 struct AlterInfo;
@@ -115,7 +118,14 @@ public:
 	void Truncate(int64_t size);
 	//! Delete the WAL file on disk. The WAL should not be used after this point.
 	void Delete();
+	//! Writes a flush entry and syncs the WAL to disk
 	void Flush();
+	//! Writes a flush entry and hands the WAL data to the file system without syncing it
+	//! Returns the position up to which the WAL has to be synced to make the written entries durable
+	idx_t WriteFlush();
+	//! Syncs the WAL up to (at least) the given position. Concurrent callers are grouped: a single caller syncs the
+	//! WAL on behalf of everyone that has written their entries before the sync started.
+	void Sync(idx_t position);
 
 	void WriteCheckpoint(MetaBlockPointer meta_block);
 
@@ -123,6 +133,20 @@ protected:
 	AttachedDatabase &database;
 	unique_ptr<BufferedFileWriter> writer;
 	string wal_path;
+
+private:
+	//! Lock protecting the sync state
+	mutex sync_lock;
+	//! Used to wake up the callers waiting for a sync to finish
+	std::condition_variable sync_finished;
+	//! The position up to which the WAL has been handed to the file system
+	idx_t written_position = 0;
+	//! The position up to which the WAL is known to be synced
+	idx_t synced_position = 0;
+	//! Whether or not a sync is currently in progress
+	bool sync_in_progress = false;
+	//! Whether or not a sync has failed - after which the WAL can no longer be made durable
+	bool sync_failed = false;
 };
 
 } // namespace duckdb
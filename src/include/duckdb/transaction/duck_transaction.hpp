@@ -14,6 +14,7 @@
 namespace duckdb {
 class RowVersionManager;
 class DuckTransactionManager;
+class StorageCommitState;
 class StorageLockKey;
 struct UndoBufferProperties;
 
@@ -44,6 +45,8 @@ public:
 	//! Commit the current transaction with the given commit identifier. Returns an error message if the transaction
 	//! commit failed, or an empty string if the commit was sucessful
 	ErrorData Commit(AttachedDatabase &db, transaction_t commit_id, bool checkpoint) noexcept;
+	//! Waits until the commit of the transaction is durable. Returns an error if the commit could not be synced.
+	ErrorData SyncCommit() noexcept;
 	//! Returns whether or not a commit of this transaction should trigger an automatic checkpoint
 	bool AutomaticCheckpoint(AttachedDatabase &db, const UndoBufferProperties &properties);
 
@@ -76,6 +79,8 @@ private:
 	unique_ptr<LocalStorage> storage;
 	//! Write lock
 	unique_ptr<StorageLockKey> write_lock;
+	//! The storage commit state of a commit that has been written but not yet synced
+	unique_ptr<StorageCommitState> storage_commit_state;
 	//! Lock for accessing sequence_usage
 	mutex sequence_lock;
 	//! Map of all sequences that were used during the transaction and the value they had in this transaction
@@ -14,6 +14,7 @@
 
 namespace duckdb {
 class DuckTransaction;
+struct ProducerToken;
 
 //! The Transaction Manager is responsible for creating and managing
 //! transactions
@@ -52,6 +53,11 @@ public:
 	unique_ptr<StorageLockKey> SharedCheckpointLock();
 	unique_ptr<StorageLockKey> TryUpgradeCheckpointLock(StorageLockKey &lock);
 
+	//! Performs a scheduled background checkpoint - if there are no active write transactions
+	void BackgroundCheckpoint();
+	//! Waits until a scheduled background checkpoint (if any) has finished
+	void WaitForBackgroundCheckpoint();
+
 protected:
 	struct CheckpointDecision {
 		explicit CheckpointDecision(string reason_p);
@@ -61,6 +67,8 @@ protected:
 		bool can_checkpoint;
 		string reason;
 		CheckpointType type;
+		//! Whether a background checkpoint should be scheduled after the transaction has committed
+		bool schedule_background_checkpoint = false;
 	};
 
 private:
@@ -74,6 +82,12 @@ private:
 	//! Whether or not we can checkpoint
 	CheckpointDecision CanCheckpoint(DuckTransaction &transaction, unique_ptr<StorageLockKey> &checkpoint_lock,
 	                                 const UndoBufferProperties &properties);
+	//! Whether or not automatic checkpoints should be performed in the background
+	bool CheckpointInBackground();
+	//! Schedules a checkpoint on the task scheduler, unless one is already scheduled
+	void ScheduleBackgroundCheckpoint();
+	//! Obtains the checkpoint lock for a background checkpoint, waiting (for a bounded time) for active writers
+	unique_ptr<StorageLockKey> ForceBackgroundCheckpointLock();
 
 private:
 	//! The current start timestamp used by transactions
@@ -98,6 +112,16 @@ private:
 	StorageLock checkpoint_lock;
 	//! Lock necessary to start transactions only - used by FORCE CHECKPOINT to prevent new transactions from starting
 	mutex start_transaction_lock;
+	//! Lock for scheduling background checkpoints
+	mutex background_checkpoint_lock;
+	//! The producer token used to schedule background checkpoints
+	unique_ptr<ProducerToken> background_checkpoint_producer;
+	//! Whether a transaction has requested a background checkpoint while one was scheduled or running
+	bool background_checkpoint_requested;
+	//! The number of background checkpoints in a row that failed to obtain the checkpoint lock
+	idx_t background_checkpoint_failed_attempts;
+	//! Whether or not a background checkpoint is scheduled or running
+	atomic<bool> background_checkpoint_pending;
 
 protected:
 	virtual void OnCommitCheckpointDecision(const CheckpointDecision &decision, DuckTransaction &transaction) {
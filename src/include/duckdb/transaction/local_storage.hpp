@@ -118,8 +118,9 @@ public:
 
 	//! Begin appending to the local storage
 	void InitializeAppend(LocalAppendState &state, DataTable &table);
-	//! Append a chunk to the local storage
-	static void Append(LocalAppendState &state, DataChunk &chunk);
+	//! Append a chunk to the local storage. If append_to_indexes is false the chunk is not added to the
+	//! transaction-local indexes - the rows are then only added to the indexes of the table on commit.
+	static void Append(LocalAppendState &state, DataChunk &chunk, bool append_to_indexes = true);
 	//! Finish appending to the local storage
 	static void FinalizeAppend(LocalAppendState &state);
 	//! Merge a row group collection into the transaction-local storage
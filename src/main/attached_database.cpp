@@ -150,6 +150,11 @@ void AttachedDatabase::Close() {
 	}
 	is_closed = true;
 
+	if (transaction_manager && transaction_manager->IsDuckTransactionManager()) {
+		// a background checkpoint might still be running - wait for it to finish before we shut down
+		DuckTransactionManager::Get(*this).WaitForBackgroundCheckpoint();
+	}
+
 	if (!IsSystem() && !catalog->InMemory()) {
 		db.GetDatabaseManager().EraseDatabasePath(catalog->GetDBPath());
 	}
@@ -10,6 +10,7 @@
 #include "duckdb/main/database_manager.hpp"
 #include "duckdb/main/query_profiler.hpp"
 #include "duckdb/main/secret/secret_manager.hpp"
+#include "duckdb/parallel/resource_group.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parser.hpp"
 #include "duckdb/planner/expression_binder.hpp"
@@ -95,6 +96,22 @@ Value CheckpointThresholdSetting::GetSetting(const ClientContext &context) {
 	return Value(StringUtil::BytesToHumanReadableString(config.options.checkpoint_wal_size));
 }
 
+//===--------------------------------------------------------------------===//
+// Background Checkpoint
+//===--------------------------------------------------------------------===//
+void BackgroundCheckpointSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.background_checkpoint = input.GetValue<bool>();
+}
+
+void BackgroundCheckpointSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.background_checkpoint = DBConfig().options.background_checkpoint;
+}
+
+Value BackgroundCheckpointSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.background_checkpoint);
+}
+
 //===--------------------------------------------------------------------===//
 // Debug Checkpoint Abort
 //===--------------------------------------------------------------------===//
@@ -1115,6 +1132,28 @@ Value MaximumTempDirectorySize::GetSetting(const ClientContext &context) {
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// NUMA Affinity
+//===--------------------------------------------------------------------===//
+void NumaAffinitySetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	if (db) {
+		throw InvalidInputException("Cannot change numa_affinity setting while database is running");
+	}
+	config.options.numa_affinity = input.GetValue<bool>();
+}
+
+void NumaAffinitySetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	if (db) {
+		throw InvalidInputException("Cannot change numa_affinity setting while database is running");
+	}
+	config.options.numa_affinity = DBConfig().options.numa_affinity;
+}
+
+Value NumaAffinitySetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.numa_affinity);
+}
+
 //===--------------------------------------------------------------------===//
 // Old Implicit Casting
 //===--------------------------------------------------------------------===//
@@ -1333,6 +1372,35 @@ Value ProgressBarTimeSetting::GetSetting(const ClientContext &context) {
 	return Value::BIGINT(ClientConfig::GetConfig(context).wait_time);
 }
 
+//===--------------------------------------------------------------------===//
+// Resource Group
+//===--------------------------------------------------------------------===//
+void ResourceGroupSetting::ResetLocal(ClientContext &context) {
+	auto &config = ClientConfig::GetConfig(context);
+	config.resource_group = ClientConfig().resource_group;
+	config.resource_group_id = ClientConfig().resource_group_id;
+}
+
+void ResourceGroupSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto parameter = input.ToString();
+	auto group = TaskScheduler::GetScheduler(context).GetResourceGroup(parameter);
+	if (!group) {
+		throw InvalidInputException("Resource group \"%s\" does not exist", parameter);
+	}
+	auto &config = ClientConfig::GetConfig(context);
+	config.resource_group = parameter;
+	config.resource_group_id = group->id;
+}
+
+Value ResourceGroupSetting::GetSetting(const ClientContext &context) {
+	// the selected group might have been dropped in the meantime
+	auto &group = TaskScheduler::GetScheduler(*context.db).GetResourceGroup(context);
+	if (group.index == 0) {
+		return Value(ResourceGroup::DEFAULT_GROUP);
+	}
+	return Value(ClientConfig::GetConfig(context).resource_group);
+}
+
 //===--------------------------------------------------------------------===//
 // Schema
 //===--------------------------------------------------------------------===//
@@ -1417,6 +1485,22 @@ Value TempDirectorySetting::GetSetting(const ClientContext &context) {
 	return Value(buffer_manager.GetTemporaryDirectory());
 }
 
+//===--------------------------------------------------------------------===//
+// Temp File Compression
+//===--------------------------------------------------------------------===//
+void TempFileCompressionSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.temp_file_compression = input.GetValue<bool>();
+}
+
+void TempFileCompressionSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.temp_file_compression = DBConfig().options.temp_file_compression;
+}
+
+Value TempFileCompressionSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.temp_file_compression);
+}
+
 //===--------------------------------------------------------------------===//
 // Threads Setting
 //===--------------------------------------------------------------------===//
@@ -0,0 +1,47 @@
+#include "duckdb/optimizer/compressed_materialization.hpp"
+#include "duckdb/planner/operator/logical_comparison_join.hpp"
+
+namespace duckdb {
+
+void CompressedMaterialization::CompressComparisonJoin(unique_ptr<LogicalOperator> &op) {
+	auto &join = op->Cast<LogicalComparisonJoin>();
+	switch (join.join_type) {
+	case JoinType::INNER:
+	case JoinType::LEFT:
+	case JoinType::RIGHT:
+	case JoinType::OUTER:
+		break;
+	default:
+		return; // Other join types do not output the build side
+	}
+
+	// Only the build side (RHS) is materialized, and only if it is large the memory savings outweigh decompressing
+	auto &build_child = *join.children[1];
+	if (build_child.EstimateCardinality(context) < JOIN_BUILD_COMPRESSION_THRESHOLD) {
+		return;
+	}
+
+	// The join keys are excluded from compression, as both sides of the condition would need the same compression
+	column_binding_set_t referenced_bindings;
+	for (const auto &condition : join.conditions) {
+		GetReferencedBindings(*condition.left, referenced_bindings);
+		GetReferencedBindings(*condition.right, referenced_bindings);
+	}
+
+	// Create info for compression
+	CompressedMaterializationInfo info(*op, {1}, referenced_bindings);
+
+	// Create binding mapping
+	const auto bindings = build_child.GetColumnBindings();
+	const auto &types = build_child.types;
+	D_ASSERT(bindings.size() == types.size());
+	for (idx_t col_idx = 0; col_idx < bindings.size(); col_idx++) {
+		// Comparison join does not change bindings, input binding is output binding
+		info.binding_map.emplace(bindings[col_idx], CMBindingInfo(bindings[col_idx], types[col_idx]));
+	}
+
+	// Now try to compress
+	CreateProjections(op, info);
+}
+
+} // namespace duckdb
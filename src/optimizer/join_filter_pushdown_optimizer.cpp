@@ -0,0 +1,173 @@
+#include "duckdb/optimizer/join_filter_pushdown_optimizer.hpp"
+
+#include "duckdb/execution/operator/join/join_filter_pushdown.hpp"
+#include "duckdb/execution/physical_plan_generator.hpp"
+#include "duckdb/main/client_config.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/operator/logical_comparison_join.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+#include "duckdb/planner/operator/logical_top_n.hpp"
+
+namespace duckdb {
+
+void JoinFilterPushdownOptimizer::VisitOperator(LogicalOperator &op) {
+	if (op.type == LogicalOperatorType::LOGICAL_COMPARISON_JOIN) {
+		GenerateJoinFilters(op.Cast<LogicalComparisonJoin>());
+	} else if (op.type == LogicalOperatorType::LOGICAL_TOP_N) {
+		GenerateTopNFilters(op.Cast<LogicalTopN>());
+	}
+	LogicalOperatorVisitor::VisitOperatorChildren(op);
+}
+
+optional_ptr<LogicalGet> JoinFilterPushdownOptimizer::FindProbeScan(LogicalOperator &op, ColumnBinding &binding) {
+	switch (op.type) {
+	case LogicalOperatorType::LOGICAL_GET: {
+		auto &get = op.Cast<LogicalGet>();
+		if (get.table_index != binding.table_index) {
+			return nullptr;
+		}
+		return &get;
+	}
+	case LogicalOperatorType::LOGICAL_PROJECTION: {
+		auto &proj = op.Cast<LogicalProjection>();
+		if (proj.table_index != binding.table_index) {
+			return nullptr;
+		}
+		auto &expr = *proj.expressions[binding.column_index];
+		if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
+			return nullptr;
+		}
+		binding = expr.Cast<BoundColumnRefExpression>().binding;
+		return FindProbeScan(*op.children[0], binding);
+	}
+	case LogicalOperatorType::LOGICAL_FILTER:
+		// filters are executed in the same pipeline as the scan
+		return FindProbeScan(*op.children[0], binding);
+	case LogicalOperatorType::LOGICAL_COMPARISON_JOIN:
+		// the probe side of a hash join is executed in the same pipeline as the scan
+		// other joins (e.g., the IEJoin) can sink their left side: the scan is then executed in a separate pipeline
+		// that can start before the filters of a (re-executed) plan have been updated
+		if (!IsHashJoin(op.Cast<LogicalComparisonJoin>())) {
+			return nullptr;
+		}
+		return FindProbeScan(*op.children[0], binding);
+	default:
+		return nullptr;
+	}
+}
+
+bool JoinFilterPushdownOptimizer::IsHashJoin(LogicalComparisonJoin &join) {
+	if (join.type != LogicalOperatorType::LOGICAL_COMPARISON_JOIN || join.conditions.empty()) {
+		return false;
+	}
+	idx_t range_count = 0;
+	if (!PhysicalPlanGenerator::HasEquality(join.conditions, range_count)) {
+		return false;
+	}
+	switch (join.join_type) {
+	case JoinType::SEMI:
+	case JoinType::ANTI:
+	case JoinType::RIGHT_ANTI:
+	case JoinType::RIGHT_SEMI:
+	case JoinType::MARK:
+		// these joins are never planned as IEJoin
+		return true;
+	default:
+		break;
+	}
+	// joins with an equality are planned as a hash join, unless we prefer an IEJoin for their range conditions
+	return range_count < 2 || !ClientConfig::GetConfig(context).prefer_range_joins;
+}
+
+bool JoinFilterPushdownOptimizer::CanPushdownFilters(LogicalGet &get, const ColumnBinding &binding) {
+	if (!get.function.filter_pushdown || !get.projected_input.empty() ||
+	    get.function.global_initialization != TableFunctionInitialization::INITIALIZE_ON_EXECUTE) {
+		return false;
+	}
+	if (binding.column_index >= get.column_ids.size() ||
+	    get.column_ids[binding.column_index] == COLUMN_IDENTIFIER_ROW_ID) {
+		return false;
+	}
+	return true;
+}
+
+void JoinFilterPushdownOptimizer::GenerateJoinFilters(LogicalComparisonJoin &join) {
+	if (!IsHashJoin(join)) {
+		// only hash joins push filters into the scan
+		return;
+	}
+	switch (join.join_type) {
+	case JoinType::INNER:
+	case JoinType::SEMI:
+	case JoinType::RIGHT:
+	case JoinType::RIGHT_SEMI:
+		// probe-side rows without a join partner are not emitted: we can filter them out in the scan
+		break;
+	default:
+		return;
+	}
+	optional_ptr<LogicalGet> probe_get;
+	vector<JoinFilterPushdownColumn> pushdown_columns;
+	for (idx_t cond_idx = 0; cond_idx < join.conditions.size(); cond_idx++) {
+		auto &cond = join.conditions[cond_idx];
+		if (cond.comparison != ExpressionType::COMPARE_EQUAL) {
+			// NULL values match for IS NOT DISTINCT FROM: we cannot push a range filter
+			continue;
+		}
+		if (cond.left->type != ExpressionType::BOUND_COLUMN_REF ||
+		    !JoinFilterPushdownInfo::SupportsType(cond.left->return_type)) {
+			continue;
+		}
+		auto binding = cond.left->Cast<BoundColumnRefExpression>().binding;
+		auto get = FindProbeScan(*join.children[0], binding);
+		if (!get || (probe_get && get.get() != probe_get.get())) {
+			continue;
+		}
+		if (!CanPushdownFilters(*get, binding)) {
+			continue;
+		}
+		probe_get = get;
+		pushdown_columns.push_back(JoinFilterPushdownColumn {cond_idx, binding.column_index});
+	}
+	if (pushdown_columns.empty()) {
+		return;
+	}
+	if (!probe_get->dynamic_filters) {
+		probe_get->dynamic_filters = make_shared_ptr<DynamicTableFilterSet>();
+	}
+	auto pushdown_info = make_uniq<JoinFilterPushdownInfo>();
+	pushdown_info->dynamic_filters = probe_get->dynamic_filters;
+	pushdown_info->filters = std::move(pushdown_columns);
+	join.filter_pushdown = std::move(pushdown_info);
+}
+
+void JoinFilterPushdownOptimizer::GenerateTopNFilters(LogicalTopN &top_n) {
+	auto &order = top_n.orders[0];
+	if (order.null_order != OrderByNullType::NULLS_LAST) {
+		// the boundary filter removes NULL values - we can only do that if they are sorted last
+		return;
+	}
+	if (order.expression->type != ExpressionType::BOUND_COLUMN_REF ||
+	    !JoinFilterPushdownInfo::SupportsType(order.expression->return_type)) {
+		return;
+	}
+	// the filter is pushed when the Top-N creates its global sink state: the scan has to be initialized after that
+	// FindProbeScan only finds scans that are executed in the same pipeline as the Top-N, which guarantees this
+	auto binding = order.expression->Cast<BoundColumnRefExpression>().binding;
+	auto get = FindProbeScan(*top_n.children[0], binding);
+	if (!get || !CanPushdownFilters(*get, binding)) {
+		return;
+	}
+	if (get->function.name != "seq_scan") {
+		// the boundary is pushed as a dynamic filter, which is only understood by our own table scan
+		return;
+	}
+	if (!get->dynamic_filters) {
+		get->dynamic_filters = make_shared_ptr<DynamicTableFilterSet>();
+	}
+	top_n.dynamic_filters = get->dynamic_filters;
+	top_n.dynamic_filter_column = binding.column_index;
+}
+
+} // namespace duckdb
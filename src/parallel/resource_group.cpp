@@ -0,0 +1,38 @@
+#include "duckdb/parallel/resource_group.hpp"
+
+#include "duckdb/common/limits.hpp"
+
+namespace duckdb {
+
+ResourceGroup::ResourceGroup(idx_t index_p)
+    : index(index_p), id(0), dropped(true), active_threads(0), active_producers(0), reservation(0) {
+	SetDefaults();
+}
+
+void ResourceGroup::Initialize(string name_p, idx_t id_p) {
+	name = std::move(name_p);
+	id = id_p;
+	dropped = false;
+	SetDefaults();
+}
+
+void ResourceGroup::SetDefaults() {
+	priority = 0;
+	thread_share = 1.0;
+	memory_limit = NumericLimits<idx_t>::Maximum();
+}
+
+idx_t ResourceGroup::MaximumThreads(idx_t thread_count) const {
+	auto maximum_threads = static_cast<idx_t>(thread_share.load() * static_cast<double>(thread_count));
+	return MaxValue<idx_t>(maximum_threads, 1);
+}
+
+bool ResourceGroup::HasMemoryLimit() const {
+	return memory_limit.load() != NumericLimits<idx_t>::Maximum();
+}
+
+bool ResourceGroup::IsUnused() const {
+	return dropped && active_producers.load() == 0 && active_threads.load() == 0;
+}
+
+} // namespace duckdb
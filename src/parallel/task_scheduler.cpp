@@ -1,10 +1,17 @@
 #include "duckdb/parallel/task_scheduler.hpp"
 
+#include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/chrono.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/file_system.hpp"
 #include "duckdb/common/numeric_utils.hpp"
+#include "duckdb/common/string_util.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/parallel/resource_group.hpp"
+
+#include <cinttypes>
+#include <cstdio>
 
 #ifndef DUCKDB_NO_THREADS
 #include "concurrentqueue.h"
@@ -12,6 +19,9 @@
 #include "lightweightsemaphore.h"
 
 #include <thread>
+#ifdef __linux__
+#include <sched.h>
+#endif
 #else
 #include <queue>
 #endif
@@ -36,22 +46,60 @@ typedef duckdb_moodycamel::ConcurrentQueue<shared_ptr<Task>> concurrent_queue_t;
 typedef duckdb_moodycamel::LightweightSemaphore lightweight_semaphore_t;
 
 struct ConcurrentQueue {
-	concurrent_queue_t q;
+	ConcurrentQueue(idx_t node_count, idx_t maximum_groups);
+
+	//! The number of NUMA nodes
+	idx_t node_count;
+	//! The task queues of every resource group, one per NUMA node
+	vector<vector<unique_ptr<concurrent_queue_t>>> group_queues;
+	//! Signalled for every scheduled task, shared by the threads of all nodes
 	lightweight_semaphore_t semaphore;
 
+	//! Creates the task queues of a new resource group (must be called before the group is visible to the threads)
+	void AddGroup(idx_t group);
+	//! Whether the task queues of the resource group are empty
+	bool IsEmpty(idx_t group);
 	void Enqueue(ProducerToken &token, shared_ptr<Task> task);
 	bool DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task);
+	//! Dequeues a task of the group from the queue of the given node, or steals one from another node if it is empty
+	bool Dequeue(idx_t group, idx_t node, shared_ptr<Task> &task);
 };
 
 struct QueueProducerToken {
-	explicit QueueProducerToken(ConcurrentQueue &queue) : queue_token(queue.q) {
+	QueueProducerToken(ConcurrentQueue &queue, idx_t group, idx_t node)
+	    : group(group), node(node), queue_token(*queue.group_queues[group][node]) {
 	}
 
+	//! The resource group the tasks of this producer belong to
+	idx_t group;
+	//! The NUMA node the tasks of this producer are scheduled on
+	idx_t node;
 	duckdb_moodycamel::ProducerToken queue_token;
 };
 
+ConcurrentQueue::ConcurrentQueue(idx_t node_count, idx_t maximum_groups) : node_count(node_count) {
+	group_queues.resize(maximum_groups);
+}
+
+void ConcurrentQueue::AddGroup(idx_t group) {
+	D_ASSERT(group_queues[group].empty());
+	for (idx_t node = 0; node < node_count; node++) {
+		group_queues[group].push_back(make_uniq<concurrent_queue_t>());
+	}
+}
+
+bool ConcurrentQueue::IsEmpty(idx_t group) {
+	for (auto &node_queue : group_queues[group]) {
+		if (node_queue->size_approx() > 0) {
+			return false;
+		}
+	}
+	return true;
+}
+
 void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
 	lock_guard<mutex> producer_lock(token.producer_lock);
+	auto &q = *group_queues[token.token->group][token.token->node];
 	if (q.enqueue(token.token->queue_token, std::move(task))) {
 		semaphore.signal();
 	} else {
@@ -61,14 +109,36 @@ void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
 
 bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
 	lock_guard<mutex> producer_lock(token.producer_lock);
+	auto &q = *group_queues[token.token->group][token.token->node];
 	return q.try_dequeue_from_producer(token.token->queue_token, task);
 }
 
+bool ConcurrentQueue::Dequeue(idx_t group, idx_t node, shared_ptr<Task> &task) {
+	// the tasks on our own node were scheduled from this node, and likely work on memory that was allocated here
+	// only if there are none we steal a task from the other nodes
+	auto &node_queues = group_queues[group];
+	for (idx_t i = 0; i < node_count; i++) {
+		if (node_queues[(node + i) % node_count]->try_dequeue(task)) {
+			return true;
+		}
+	}
+	return false;
+}
+
 #else
 struct ConcurrentQueue {
+	ConcurrentQueue(idx_t node_count, idx_t maximum_groups) {
+	}
+
 	std::queue<shared_ptr<Task>> q;
 	mutex qlock;
 
+	void AddGroup(idx_t group) {
+	}
+	bool IsEmpty(idx_t group) {
+		return true;
+	}
+
 	void Enqueue(ProducerToken &token, shared_ptr<Task> task);
 	bool DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task);
 };
@@ -89,22 +159,81 @@ bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task>
 }
 
 struct QueueProducerToken {
-	QueueProducerToken(ConcurrentQueue &queue) {
+	QueueProducerToken(ConcurrentQueue &queue, idx_t group, idx_t node) {
 	}
 };
 #endif
 
-ProducerToken::ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token)
-    : scheduler(scheduler), token(std::move(token)) {
+//! Reads the CPUs of every NUMA node of the system, returns an empty list if the topology is unknown
+static vector<vector<idx_t>> GetNodeCPUs(FileSystem &fs) {
+	vector<vector<idx_t>> result;
+#if defined(__linux__) && !defined(DUCKDB_NO_THREADS)
+	for (idx_t node = 0;; node++) {
+		auto cpu_list_path = StringUtil::Format("/sys/devices/system/node/node%llu/cpulist", node);
+		if (!fs.FileExists(cpu_list_path)) {
+			break;
+		}
+		// the CPU list is a comma-separated list of ranges, e.g. "0-15,32-47"
+		auto handle = fs.OpenFile(cpu_list_path, FileFlags::FILE_FLAGS_READ);
+		vector<idx_t> cpus;
+		for (auto &range : StringUtil::Split(handle->ReadLine(), ',')) {
+			uint64_t start, end;
+			auto matched = std::sscanf(range.c_str(), "%" SCNu64 "-%" SCNu64, &start, &end);
+			if (matched < 1) {
+				return vector<vector<idx_t>>();
+			}
+			if (matched == 1) {
+				end = start;
+			}
+			for (auto cpu = start; cpu <= end; cpu++) {
+				cpus.push_back(cpu);
+			}
+		}
+		if (!cpus.empty()) {
+			// skip nodes without CPUs (memory-only nodes)
+			result.push_back(std::move(cpus));
+		}
+	}
+#endif
+	return result;
+}
+
+ProducerToken::ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token,
+                             ResourceGroup &resource_group)
+    : scheduler(scheduler), token(std::move(token)), resource_group(resource_group) {
+	resource_group.active_producers++;
 }
 
 ProducerToken::~ProducerToken() {
+	resource_group.active_producers--;
 }
 
 TaskScheduler::TaskScheduler(DatabaseInstance &db)
-    : db(db), queue(make_uniq<ConcurrentQueue>()),
-      allocator_flush_threshold(db.config.options.allocator_flush_threshold), requested_thread_count(0),
-      current_thread_count(1) {
+    : db(db), resource_group_count(0), next_resource_group_id(0), resource_group_order_count(0),
+      allocator_flush_threshold(db.config.options.allocator_flush_threshold),
+      requested_thread_count(0), current_thread_count(1) {
+	if (db.config.options.numa_affinity && db.config.file_system) {
+		node_cpus = GetNodeCPUs(*db.config.file_system);
+	}
+	if (node_cpus.size() <= 1) {
+		// a single node: all threads share one queue, and are not pinned to any CPU
+		node_cpus.clear();
+		node_cpus.emplace_back();
+	}
+	for (idx_t node = 0; node < node_cpus.size(); node++) {
+		for (auto &cpu : node_cpus[node]) {
+			if (cpu >= cpu_nodes.size()) {
+				cpu_nodes.resize(cpu + 1, 0);
+			}
+			cpu_nodes[cpu] = node;
+		}
+	}
+	queue = make_uniq<ConcurrentQueue>(node_cpus.size(), MAXIMUM_RESOURCE_GROUPS);
+	resource_groups.resize(MAXIMUM_RESOURCE_GROUPS);
+	for (idx_t i = 0; i < MAXIMUM_RESOURCE_GROUPS; i++) {
+		resource_group_order[i] = 0;
+	}
+	CreateResourceGroup(ResourceGroup::DEFAULT_GROUP);
 }
 
 TaskScheduler::~TaskScheduler() {
@@ -125,9 +254,175 @@ TaskScheduler &TaskScheduler::GetScheduler(DatabaseInstance &db) {
 	return db.GetScheduler();
 }
 
+idx_t TaskScheduler::NumberOfNodes() const {
+	return node_cpus.size();
+}
+
+idx_t TaskScheduler::GetCurrentNode() const {
+#if defined(__linux__) && !defined(DUCKDB_NO_THREADS)
+	if (node_cpus.size() > 1) {
+		auto cpu = sched_getcpu();
+		if (cpu >= 0 && NumericCast<idx_t>(cpu) < cpu_nodes.size()) {
+			return cpu_nodes[NumericCast<idx_t>(cpu)];
+		}
+	}
+#endif
+	return 0;
+}
+
 unique_ptr<ProducerToken> TaskScheduler::CreateProducer() {
-	auto token = make_uniq<QueueProducerToken>(*queue);
-	return make_uniq<ProducerToken>(*this, std::move(token));
+	return CreateProducer(*resource_groups[0]);
+}
+
+unique_ptr<ProducerToken> TaskScheduler::CreateProducer(ResourceGroup &group) {
+	auto token = make_uniq<QueueProducerToken>(*queue, group.index, GetCurrentNode());
+	return make_uniq<ProducerToken>(*this, std::move(token), group);
+}
+
+ResourceGroup &TaskScheduler::CreateResourceGroup(const string &name) {
+	lock_guard<mutex> guard(resource_group_lock);
+	auto entry = resource_group_map.find(name);
+	if (entry != resource_group_map.end()) {
+		// the group already exists: reset its settings
+		auto &group = *resource_groups[entry->second];
+		group.SetDefaults();
+		UpdateResourceGroupOrder();
+		return group;
+	}
+	// re-use the index of a dropped group that is no longer in use, if there is any
+	auto group_count = resource_group_count.load();
+	optional_ptr<ResourceGroup> result;
+	for (idx_t group_idx = 0; group_idx < group_count; group_idx++) {
+		auto &group = *resource_groups[group_idx];
+		if (group.IsUnused() && queue->IsEmpty(group_idx)) {
+			result = &group;
+			break;
+		}
+	}
+	if (!result) {
+		if (group_count >= MAXIMUM_RESOURCE_GROUPS) {
+			throw InvalidInputException("Cannot create more than %llu resource groups", MAXIMUM_RESOURCE_GROUPS);
+		}
+		resource_groups[group_count] = make_uniq<ResourceGroup>(group_count);
+		queue->AddGroup(group_count);
+		result = resource_groups[group_count].get();
+		// only now the threads can see the group
+		resource_group_count = group_count + 1;
+	}
+	// the new group gets a new id: clients that selected a dropped group with the same name do not switch to it
+	result->Initialize(name, next_resource_group_id++);
+	resource_group_map[name] = result->index;
+	UpdateResourceGroupOrder();
+	return *result;
+}
+
+void TaskScheduler::SetResourceGroupPriority(ResourceGroup &group, int64_t priority) {
+	lock_guard<mutex> guard(resource_group_lock);
+	group.priority = priority;
+	UpdateResourceGroupOrder();
+}
+
+void TaskScheduler::DropResourceGroup(const string &name) {
+	lock_guard<mutex> guard(resource_group_lock);
+	if (StringUtil::CIEquals(name, ResourceGroup::DEFAULT_GROUP)) {
+		throw InvalidInputException("Cannot drop the default resource group");
+	}
+	auto entry = resource_group_map.find(name);
+	if (entry == resource_group_map.end()) {
+		throw InvalidInputException("Resource group \"%s\" does not exist", name);
+	}
+	// the tasks that were already scheduled in the group still get executed, new queries use the default group
+	resource_groups[entry->second]->dropped = true;
+	resource_group_map.erase(entry);
+	UpdateResourceGroupOrder();
+}
+
+void TaskScheduler::UpdateResourceGroupOrder() {
+	vector<idx_t> group_order;
+	for (auto &entry : resource_group_map) {
+		group_order.push_back(entry.second);
+	}
+	std::stable_sort(group_order.begin(), group_order.end(), [&](idx_t a, idx_t b) {
+		return resource_groups[a]->priority.load() > resource_groups[b]->priority.load();
+	});
+	// the threads read the order without holding the lock: they might see a mix of the old and the new order
+	// this only affects the order in which they consider the groups, as they fall back to all groups anyway
+	for (idx_t i = 0; i < group_order.size(); i++) {
+		resource_group_order[i] = group_order[i];
+	}
+	resource_group_order_count = group_order.size();
+}
+
+optional_ptr<ResourceGroup> TaskScheduler::GetResourceGroup(const string &name) {
+	lock_guard<mutex> guard(resource_group_lock);
+	auto entry = resource_group_map.find(name);
+	if (entry == resource_group_map.end()) {
+		return nullptr;
+	}
+	return resource_groups[entry->second].get();
+}
+
+ResourceGroup &TaskScheduler::GetResourceGroup(const ClientContext &context) {
+	auto &config = ClientConfig::GetConfig(context);
+	if (!config.resource_group.empty()) {
+		lock_guard<mutex> guard(resource_group_lock);
+		auto entry = resource_group_map.find(config.resource_group);
+		if (entry != resource_group_map.end()) {
+			auto &group = *resource_groups[entry->second];
+			if (group.id == config.resource_group_id) {
+				return group;
+			}
+		}
+	}
+	// the client did not select a group, or it was dropped (and possibly created again)
+	return *resource_groups[0];
+}
+
+//! Counts a thread towards the active threads of a resource group while it executes a task of the group
+struct ResourceGroupThread {
+	explicit ResourceGroupThread(ResourceGroup &group) : group(group) {
+		group.active_threads++;
+	}
+	~ResourceGroupThread() {
+		group.active_threads--;
+	}
+
+	ResourceGroup &group;
+};
+
+bool TaskScheduler::DequeueTask(idx_t node, shared_ptr<Task> &task, optional_ptr<ResourceGroup> &group) {
+#ifndef DUCKDB_NO_THREADS
+	auto group_count = resource_group_count.load();
+	if (group_count == 1) {
+		// only the default group
+		group = resource_groups[0].get();
+		return queue->Dequeue(0, node, task);
+	}
+	// first only consider the groups that are not using their share of the threads yet, by priority
+	// if none of them have tasks, the other groups may use this thread: we never keep a thread idle if there is work
+	auto thread_count = NumericCast<idx_t>(NumberOfThreads());
+	auto order_count = MinValue<idx_t>(resource_group_order_count.load(), MAXIMUM_RESOURCE_GROUPS);
+	for (idx_t pass = 0; pass < 2; pass++) {
+		for (idx_t i = 0; i < order_count; i++) {
+			auto &candidate = *resource_groups[resource_group_order[i].load()];
+			if (pass == 0 && candidate.active_threads.load() >= candidate.MaximumThreads(thread_count)) {
+				continue;
+			}
+			if (queue->Dequeue(candidate.index, node, task)) {
+				group = &candidate;
+				return true;
+			}
+		}
+	}
+	// finally consider all groups: this includes the remaining tasks of dropped groups
+	for (idx_t group_idx = 0; group_idx < group_count; group_idx++) {
+		if (queue->Dequeue(group_idx, node, task)) {
+			group = resource_groups[group_idx].get();
+			return true;
+		}
+	}
+#endif
+	return false;
 }
 
 void TaskScheduler::ScheduleTask(ProducerToken &token, shared_ptr<Task> task) {
@@ -140,13 +435,19 @@ bool TaskScheduler::GetTaskFromProducer(ProducerToken &token, shared_ptr<Task> &
 }
 
 void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
+	ExecuteForever(marker, GetCurrentNode());
+}
+
+void TaskScheduler::ExecuteForever(atomic<bool> *marker, idx_t node) {
 #ifndef DUCKDB_NO_THREADS
 	shared_ptr<Task> task;
+	optional_ptr<ResourceGroup> group;
 	// loop until the marker is set to false
 	while (*marker) {
 		// wait for a signal with a timeout
 		queue->semaphore.wait();
-		if (queue->q.try_dequeue(task)) {
+		if (DequeueTask(node, task, group)) {
+			ResourceGroupThread group_thread(*group);
 			auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
 
 			switch (execute_result) {
@@ -174,12 +475,15 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
 #ifndef DUCKDB_NO_THREADS
 	idx_t completed_tasks = 0;
+	auto node = GetCurrentNode();
 	// loop until the marker is set to false
 	while (*marker && completed_tasks < max_tasks) {
 		shared_ptr<Task> task;
-		if (!queue->q.try_dequeue(task)) {
+		optional_ptr<ResourceGroup> group;
+		if (!DequeueTask(node, task, group)) {
 			return completed_tasks;
 		}
+		ResourceGroupThread group_thread(*group);
 		auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
 
 		switch (execute_result) {
@@ -205,11 +509,14 @@ idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
 void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 #ifndef DUCKDB_NO_THREADS
 	shared_ptr<Task> task;
+	optional_ptr<ResourceGroup> group;
+	auto node = GetCurrentNode();
 	for (idx_t i = 0; i < max_tasks; i++) {
 		queue->semaphore.wait(TASK_TIMEOUT_USECS);
-		if (!queue->q.try_dequeue(task)) {
+		if (!DequeueTask(node, task, group)) {
 			return;
 		}
+		ResourceGroupThread group_thread(*group);
 		try {
 			auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
 			switch (execute_result) {
@@ -234,8 +541,27 @@ void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 }
 
 #ifndef DUCKDB_NO_THREADS
-static void ThreadExecuteTasks(TaskScheduler *scheduler, atomic<bool> *marker) {
-	scheduler->ExecuteForever(marker);
+static void SetThreadAffinity(const vector<idx_t> &cpus) {
+#ifdef __linux__
+	if (cpus.empty()) {
+		return;
+	}
+	cpu_set_t cpu_set;
+	CPU_ZERO(&cpu_set);
+	for (auto &cpu : cpus) {
+		if (cpu < CPU_SETSIZE) {
+			CPU_SET(cpu, &cpu_set);
+		}
+	}
+	// if this fails (e.g. because the CPUs are not in our cgroup) the thread just keeps running on any CPU
+	sched_setaffinity(0, sizeof(cpu_set_t), &cpu_set);
+#endif
+}
+
+static void ThreadExecuteTasks(TaskScheduler *scheduler, atomic<bool> *marker, idx_t node,
+                               const vector<idx_t> *cpus) {
+	SetThreadAffinity(*cpus);
+	scheduler->ExecuteForever(marker, node);
 }
 #endif
 
@@ -308,11 +634,12 @@ void TaskScheduler::RelaunchThreadsInternal(int32_t n) {
 		// we are increasing the number of threads: launch them and run tasks on them
 		idx_t create_new_threads = new_thread_count - threads.size();
 		for (idx_t i = 0; i < create_new_threads; i++) {
-			// launch a thread and assign it a cancellation marker
+			// launch a thread and assign it a cancellation marker, the threads are distributed over the NUMA nodes
 			auto marker = unique_ptr<atomic<bool>>(new atomic<bool>(true));
+			auto node = threads.size() % node_cpus.size();
 			unique_ptr<thread> worker_thread;
 			try {
-				worker_thread = make_uniq<thread>(ThreadExecuteTasks, this, marker.get());
+				worker_thread = make_uniq<thread>(ThreadExecuteTasks, this, marker.get(), node, &node_cpus[node]);
 			} catch (std::exception &ex) {
 				// thread constructor failed - this can happen when the system has too many threads allocated
 				// in this case we cannot allocate more threads - stop launching them
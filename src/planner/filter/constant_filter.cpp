@@ -35,6 +35,10 @@ string ConstantFilter::ToString(const string &column_name) {
 	return column_name + ExpressionTypeToOperator(comparison_type) + constant.ToSQLString();
 }
 
+unique_ptr<TableFilter> ConstantFilter::Copy() const {
+	return make_uniq<ConstantFilter>(comparison_type, constant);
+}
+
 bool ConstantFilter::Equals(const TableFilter &other_p) const {
 	if (!TableFilter::Equals(other_p)) {
 		return false;
@@ -0,0 +1,82 @@
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+
+namespace duckdb {
+
+shared_ptr<ConstantFilter> DynamicFilterData::GetFilter() const {
+	return shared_ptr<ConstantFilter>(std::atomic_load(&filter));
+}
+
+void DynamicFilterData::SetValue(ExpressionType comparison_type, Value val) {
+	lock_guard<mutex> l(lock);
+	// only the updates take the lock, so we can read the current filter directly
+	if (filter) {
+		D_ASSERT(filter->comparison_type == comparison_type);
+		// only replace the filter if the new constant is more selective
+		auto &current = filter->constant;
+		switch (comparison_type) {
+		case ExpressionType::COMPARE_LESSTHAN:
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+			if (!(val < current)) {
+				return;
+			}
+			break;
+		case ExpressionType::COMPARE_GREATERTHAN:
+		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+			if (!(val > current)) {
+				return;
+			}
+			break;
+		default:
+			break;
+		}
+	}
+	// publish a new filter: scans that loaded the previous filter keep it alive until they are done with it
+	std::atomic_store(&filter, std::make_shared<ConstantFilter>(comparison_type, std::move(val)));
+}
+
+void DynamicFilterData::Reset() {
+	lock_guard<mutex> l(lock);
+	std::atomic_store(&filter, std::shared_ptr<ConstantFilter>());
+}
+
+DynamicFilter::DynamicFilter() : TableFilter(TableFilterType::DYNAMIC_FILTER) {
+}
+
+DynamicFilter::DynamicFilter(shared_ptr<DynamicFilterData> filter_data_p)
+    : TableFilter(TableFilterType::DYNAMIC_FILTER), filter_data(std::move(filter_data_p)) {
+}
+
+FilterPropagateResult DynamicFilter::CheckStatistics(BaseStatistics &stats) {
+	if (!filter_data) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	auto filter = filter_data->GetFilter();
+	if (!filter) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	return filter->CheckStatistics(stats);
+}
+
+string DynamicFilter::ToString(const string &column_name) {
+	auto filter = filter_data ? filter_data->GetFilter() : nullptr;
+	if (!filter) {
+		return "Dynamic Filter (" + column_name + ")";
+	}
+	return filter->ToString(column_name);
+}
+
+unique_ptr<TableFilter> DynamicFilter::Copy() const {
+	// the copy refers to the same filter data, so it observes any updates to the filter
+	return make_uniq<DynamicFilter>(filter_data);
+}
+
+bool DynamicFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<DynamicFilter>();
+	return other.filter_data.get() == filter_data.get();
+}
+
+} // namespace duckdb
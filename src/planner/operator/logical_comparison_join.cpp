@@ -2,12 +2,16 @@
 #include "duckdb/planner/operator/logical_comparison_join.hpp"
 #include "duckdb/planner/expression/bound_comparison_expression.hpp"
 #include "duckdb/common/enum_util.hpp"
+#include "duckdb/execution/operator/join/join_filter_pushdown.hpp"
 namespace duckdb {
 
 LogicalComparisonJoin::LogicalComparisonJoin(JoinType join_type, LogicalOperatorType logical_type)
     : LogicalJoin(join_type, logical_type) {
 }
 
+LogicalComparisonJoin::~LogicalComparisonJoin() {
+}
+
 string LogicalComparisonJoin::ParamsToString() const {
 	string result = EnumUtil::ToChars(join_type);
 	for (auto &condition : conditions) {
@@ -3,6 +3,7 @@
 #include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/common/serializer/binary_serializer.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/storage/table/column_checkpoint_state.hpp"
 #include "duckdb/storage/table/table_statistics.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
@@ -60,6 +61,10 @@ void SingleFileTableDataWriter::FinalizeTable(const TableStatistics &global_stat
 	stats_serializer.End();
 
 	// now start writing the row group pointers to disk
+	// newer row group properties are only written if the storage compatibility allows it
+	SerializationOptions serialization_options;
+	auto &config = DBConfig::GetConfig(table.ParentCatalog().GetDatabase());
+	serialization_options.serialization_compatibility = config.options.serialization_compatibility;
 	table_data_writer.Write<uint64_t>(row_group_pointers.size());
 	idx_t total_rows = 0;
 	for (auto &row_group_pointer : row_group_pointers) {
@@ -69,7 +74,7 @@ void SingleFileTableDataWriter::FinalizeTable(const TableStatistics &global_stat
 		}
 
 		// Each RowGroup is its own unit
-		BinarySerializer row_group_serializer(table_data_writer);
+		BinarySerializer row_group_serializer(table_data_writer, serialization_options);
 		row_group_serializer.Begin();
 		RowGroup::Serialize(row_group_pointer, row_group_serializer);
 		row_group_serializer.End();
@@ -546,14 +546,10 @@ void CheckpointReader::ReadTableData(CatalogTransaction transaction, Deserialize
 		}
 	}
 
-	// FIXME: icky downcast to get the underlying MetadataReader
-	auto &binary_deserializer = dynamic_cast<BinaryDeserializer &>(deserializer);
-	auto &reader = dynamic_cast<MetadataReader &>(binary_deserializer.GetStream());
-
-	MetadataReader table_data_reader(reader.GetMetadataManager(), table_pointer);
-	TableDataReader data_reader(table_data_reader, bound_info);
-	data_reader.ReadTableData();
-
+	// the statistics and row group pointers are only read when the table data is first accessed
+	// this avoids reading the metadata of every table when the database is opened
+	bound_info.data = make_uniq<PersistentTableData>(bound_info.Base().columns.PhysicalColumnCount());
+	bound_info.data->table_pointer = table_pointer;
 	bound_info.data->total_rows = total_rows;
 }
 
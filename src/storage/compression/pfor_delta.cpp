@@ -0,0 +1,574 @@
+#include "duckdb/common/bitpacking.hpp"
+
+#include "duckdb/common/limits.hpp"
+#include "duckdb/common/numeric_utils.hpp"
+#include "duckdb/function/compression/compression.hpp"
+#include "duckdb/function/compression_function.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/table/column_data_checkpointer.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
+
+namespace duckdb {
+
+//===--------------------------------------------------------------------===//
+// PFOR-Delta
+//===--------------------------------------------------------------------===//
+// Values are compressed in groups of PFOR_DELTA_GROUP_SIZE. Every group stores the deltas between consecutive values,
+// minus the smallest delta of the group (the frame of reference), bitpacked at a width that is chosen to minimize the
+// size of the group. Deltas that do not fit in that width are stored as exceptions: their position in the group and
+// their high bits, which are patched into the unpacked deltas when scanning.
+// NULL values repeat the previous value, so they do not break up the deltas.
+//
+// Segment layout:
+// [idx_t offset of the end of the metadata][group 0][group 1]...[group metadata (growing downwards)]
+// Group layout:
+// [T base][T frame of reference][uint32_t width][uint32_t exception count][bitpacked deltas]
+// [uint16_t exception positions][T exception high bits]
+// The metadata holds the uint32_t offset of every group, so any group can be decoded without decoding the previous one
+
+static constexpr const idx_t PFOR_DELTA_GROUP_SIZE = STANDARD_VECTOR_SIZE > 512 ? STANDARD_VECTOR_SIZE : 2048;
+
+using pfor_delta_exception_position_t = uint16_t;
+using pfor_delta_metadata_t = uint32_t;
+
+template <class T>
+static constexpr idx_t PForDeltaHeaderSize() {
+	return 2 * sizeof(T) + 2 * sizeof(uint32_t);
+}
+
+struct EmptyPForDeltaWriter {
+	template <class T, class T_U>
+	static void WriteGroup(T base, T frame_of_reference, bitpacking_width_t width, T_U *deltas, idx_t count,
+	                       const vector<pfor_delta_exception_position_t> &exceptions, void *data_ptr) {
+	}
+};
+
+template <class T>
+struct PForDeltaState {
+	using T_U = typename MakeUnsigned<T>::type;
+	using T_S = typename MakeSigned<T>::type;
+
+	static constexpr const idx_t TYPE_BITS = sizeof(T) * 8;
+
+public:
+	PForDeltaState() : values_idx(0), total_size(0), data_ptr(nullptr) {
+		Reset();
+	}
+
+	T values[PFOR_DELTA_GROUP_SIZE];
+	T_U deltas[PFOR_DELTA_GROUP_SIZE];
+	bool validity[PFOR_DELTA_GROUP_SIZE];
+	idx_t values_idx;
+	idx_t total_size;
+	vector<pfor_delta_exception_position_t> exceptions;
+
+	// Used to pass CompressionState ptr through the PFOR-Delta writer
+	void *data_ptr;
+
+	// Stats on the current group
+	T minimum;
+	T maximum;
+	bool all_invalid;
+
+public:
+	void Reset() {
+		minimum = NumericLimits<T>::Maximum();
+		maximum = NumericLimits<T>::Minimum();
+		all_invalid = true;
+		values_idx = 0;
+	}
+
+	//! The size of a group of count values at the given width with exception_count exceptions
+	static idx_t GetGroupSize(idx_t count, bitpacking_width_t width, idx_t exception_count) {
+		return PForDeltaHeaderSize<T>() + BitpackingPrimitives::GetRequiredSize(count, width) +
+		       exception_count * (sizeof(pfor_delta_exception_position_t) + sizeof(T));
+	}
+
+	static bitpacking_width_t GetWidth(T_U value) {
+		bitpacking_width_t width = 0;
+		while (value) {
+			width++;
+			value >>= 1;
+		}
+		return width;
+	}
+
+	//! Computes the deltas of the group, and returns the frame of reference that was subtracted from them
+	T_U ComputeDeltas() {
+		// NULLs repeat the previous value (or the first valid value at the start of the group)
+		T previous = minimum;
+		for (idx_t i = 0; i < values_idx; i++) {
+			if (validity[i]) {
+				previous = values[i];
+				break;
+			}
+		}
+		for (idx_t i = 0; i < values_idx; i++) {
+			if (!validity[i]) {
+				values[i] = previous;
+			}
+			previous = values[i];
+		}
+		// the deltas are computed with wrapping arithmetic, which decodes correctly regardless of overflow
+		T_S minimum_delta = NumericLimits<T_S>::Maximum();
+		for (idx_t i = 1; i < values_idx; i++) {
+			deltas[i] = static_cast<T_U>(values[i]) - static_cast<T_U>(values[i - 1]);
+			minimum_delta = MinValue<T_S>(minimum_delta, static_cast<T_S>(deltas[i]));
+		}
+		if (values_idx < 2) {
+			minimum_delta = 0;
+		}
+		auto frame_of_reference = static_cast<T_U>(minimum_delta);
+		deltas[0] = 0;
+		for (idx_t i = 1; i < values_idx; i++) {
+			deltas[i] -= frame_of_reference;
+		}
+		return frame_of_reference;
+	}
+
+	//! Chooses the width that minimizes the group size, and collects the positions of the deltas that exceed it
+	bitpacking_width_t ChooseWidth() {
+		idx_t width_counts[TYPE_BITS + 1] = {0};
+		for (idx_t i = 0; i < values_idx; i++) {
+			width_counts[GetWidth(deltas[i])]++;
+		}
+		bitpacking_width_t maximum_width = TYPE_BITS;
+		while (maximum_width > 0 && width_counts[maximum_width] == 0) {
+			maximum_width--;
+		}
+		bitpacking_width_t best_width = maximum_width;
+		idx_t best_size = GetGroupSize(values_idx, maximum_width, 0);
+		idx_t exception_count = 0;
+		for (idx_t width = maximum_width; width > 0; width--) {
+			// lowering the width to width - 1 turns the deltas of exactly width bits into exceptions
+			exception_count += width_counts[width];
+			auto size = GetGroupSize(values_idx, NumericCast<bitpacking_width_t>(width - 1), exception_count);
+			if (size < best_size) {
+				best_size = size;
+				best_width = NumericCast<bitpacking_width_t>(width - 1);
+			}
+		}
+		exceptions.clear();
+		if (best_width < maximum_width) {
+			for (idx_t i = 0; i < values_idx; i++) {
+				if (GetWidth(deltas[i]) > best_width) {
+					exceptions.push_back(NumericCast<pfor_delta_exception_position_t>(i));
+				}
+			}
+		}
+		return best_width;
+	}
+
+	template <class OP>
+	void Flush() {
+		if (values_idx == 0) {
+			return;
+		}
+		auto frame_of_reference = ComputeDeltas();
+		auto width = ChooseWidth();
+		// the base is chosen such that base + frame_of_reference + deltas[0] = values[0]
+		auto base = static_cast<T>(static_cast<T_U>(values[0]) - frame_of_reference);
+		OP::template WriteGroup<T, T_U>(base, static_cast<T>(frame_of_reference), width, deltas, values_idx,
+		                                exceptions, data_ptr);
+		total_size += GetGroupSize(values_idx, width, exceptions.size()) + sizeof(pfor_delta_metadata_t);
+	}
+
+	template <class OP = EmptyPForDeltaWriter>
+	void Update(T value, bool is_valid) {
+		validity[values_idx] = is_valid;
+		if (is_valid) {
+			values[values_idx] = value;
+			minimum = MinValue<T>(minimum, value);
+			maximum = MaxValue<T>(maximum, value);
+			all_invalid = false;
+		}
+		values_idx++;
+		if (values_idx == PFOR_DELTA_GROUP_SIZE) {
+			Flush<OP>();
+			Reset();
+		}
+	}
+};
+
+//===--------------------------------------------------------------------===//
+// Analyze
+//===--------------------------------------------------------------------===//
+template <class T>
+struct PForDeltaAnalyzeState : public AnalyzeState {
+	PForDeltaState<T> state;
+};
+
+template <class T>
+unique_ptr<AnalyzeState> PForDeltaInitAnalyze(ColumnData &col_data, PhysicalType type) {
+	return make_uniq<PForDeltaAnalyzeState<T>>();
+}
+
+template <class T>
+bool PForDeltaAnalyze(AnalyzeState &state, Vector &input, idx_t count) {
+	auto &analyze_state = state.Cast<PForDeltaAnalyzeState<T>>();
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+
+	auto data = UnifiedVectorFormat::GetData<T>(vdata);
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		analyze_state.state.template Update<EmptyPForDeltaWriter>(data[idx], vdata.validity.RowIsValid(idx));
+	}
+	return true;
+}
+
+template <class T>
+idx_t PForDeltaFinalAnalyze(AnalyzeState &state) {
+	auto &analyze_state = state.Cast<PForDeltaAnalyzeState<T>>();
+	analyze_state.state.template Flush<EmptyPForDeltaWriter>();
+	return analyze_state.state.total_size;
+}
+
+//===--------------------------------------------------------------------===//
+// Compress
+//===--------------------------------------------------------------------===//
+template <class T>
+struct PForDeltaCompressState : public CompressionState {
+public:
+	explicit PForDeltaCompressState(ColumnDataCheckpointer &checkpointer)
+	    : checkpointer(checkpointer),
+	      function(checkpointer.GetCompressionFunction(CompressionType::COMPRESSION_PFOR_DELTA)) {
+		CreateEmptySegment(checkpointer.GetRowGroup().start);
+		state.data_ptr = reinterpret_cast<void *>(this);
+	}
+
+	ColumnDataCheckpointer &checkpointer;
+	CompressionFunction &function;
+	unique_ptr<ColumnSegment> current_segment;
+	BufferHandle handle;
+
+	// Ptr to next free spot in segment
+	data_ptr_t data_ptr;
+	// Ptr to next free spot for storing the group offsets (growing downwards)
+	data_ptr_t metadata_ptr;
+
+	PForDeltaState<T> state;
+
+public:
+	struct PForDeltaWriter {
+		template <class T_IN, class T_U>
+		static void WriteGroup(T_IN base, T_IN frame_of_reference, bitpacking_width_t width, T_U *deltas, idx_t count,
+		                       const vector<pfor_delta_exception_position_t> &exceptions, void *data_ptr) {
+			auto compress_state = reinterpret_cast<PForDeltaCompressState<T> *>(data_ptr);
+			auto group_size = PForDeltaState<T>::GetGroupSize(count, width, exceptions.size());
+			compress_state->FlushAndCreateSegmentIfFull(group_size);
+
+			// write the offset of the group to the metadata
+			compress_state->metadata_ptr -= sizeof(pfor_delta_metadata_t);
+			Store<pfor_delta_metadata_t>(
+			    NumericCast<pfor_delta_metadata_t>(compress_state->data_ptr - compress_state->handle.Ptr()),
+			    compress_state->metadata_ptr);
+
+			auto &ptr = compress_state->data_ptr;
+			Store<T_IN>(base, ptr);
+			ptr += sizeof(T_IN);
+			Store<T_IN>(frame_of_reference, ptr);
+			ptr += sizeof(T_IN);
+			Store<uint32_t>(width, ptr);
+			ptr += sizeof(uint32_t);
+			Store<uint32_t>(NumericCast<uint32_t>(exceptions.size()), ptr);
+			ptr += sizeof(uint32_t);
+
+			// the exceptions store their high bits after their positions: only the low bits are packed
+			auto packed_size = BitpackingPrimitives::GetRequiredSize(count, width);
+			auto exception_positions = ptr + packed_size;
+			auto exception_values = exception_positions + exceptions.size() * sizeof(pfor_delta_exception_position_t);
+			for (idx_t i = 0; i < exceptions.size(); i++) {
+				auto position = exceptions[i];
+				Store<pfor_delta_exception_position_t>(
+				    position, exception_positions + i * sizeof(pfor_delta_exception_position_t));
+				Store<T_U>(deltas[position] >> width, exception_values + i * sizeof(T_U));
+				deltas[position] &= (T_U(1) << width) - T_U(1);
+			}
+			BitpackingPrimitives::PackBuffer<T_U, false>(ptr, deltas, count, width);
+			ptr = exception_values + exceptions.size() * sizeof(T_U);
+			// keep the groups aligned
+			auto aligned_ptr = compress_state->handle.Ptr() +
+			                   AlignValue(NumericCast<idx_t>(ptr - compress_state->handle.Ptr()));
+			memset(ptr, 0, NumericCast<idx_t>(aligned_ptr - ptr));
+			ptr = aligned_ptr;
+
+			compress_state->UpdateStats(count);
+		}
+	};
+
+	bool CanStore(idx_t data_bytes, idx_t meta_bytes) {
+		auto used_data_bytes = AlignValue(NumericCast<idx_t>(data_ptr - handle.Ptr()) + data_bytes);
+		auto used_meta_bytes = NumericCast<idx_t>(handle.Ptr() + Storage::BLOCK_SIZE - metadata_ptr) + meta_bytes;
+		return used_data_bytes + used_meta_bytes <= Storage::BLOCK_SIZE;
+	}
+
+	void CreateEmptySegment(idx_t row_start) {
+		auto &db = checkpointer.GetDatabase();
+		auto &type = checkpointer.GetType();
+		auto compressed_segment = ColumnSegment::CreateTransientSegment(db, type, row_start);
+		compressed_segment->function = function;
+		current_segment = std::move(compressed_segment);
+		auto &buffer_manager = BufferManager::GetBufferManager(db);
+		handle = buffer_manager.Pin(current_segment->block);
+
+		data_ptr = handle.Ptr() + sizeof(idx_t);
+		metadata_ptr = handle.Ptr() + Storage::BLOCK_SIZE;
+	}
+
+	void UpdateStats(idx_t count) {
+		current_segment->count += count;
+		if (!state.all_invalid) {
+			NumericStats::Update<T>(current_segment->stats.statistics, state.minimum);
+			NumericStats::Update<T>(current_segment->stats.statistics, state.maximum);
+		}
+	}
+
+	void Append(UnifiedVectorFormat &vdata, idx_t count) {
+		auto data = UnifiedVectorFormat::GetData<T>(vdata);
+		for (idx_t i = 0; i < count; i++) {
+			auto idx = vdata.sel->get_index(i);
+			state.template Update<PForDeltaWriter>(data[idx], vdata.validity.RowIsValid(idx));
+		}
+	}
+
+	void FlushAndCreateSegmentIfFull(idx_t group_size) {
+		if (!CanStore(group_size, sizeof(pfor_delta_metadata_t))) {
+			auto row_start = current_segment->start + current_segment->count;
+			FlushSegment();
+			CreateEmptySegment(row_start);
+		}
+	}
+
+	void FlushSegment() {
+		auto &checkpoint_state = checkpointer.GetCheckpointState();
+		auto base_ptr = handle.Ptr();
+
+		// compact the segment by moving the metadata next to the data
+		auto metadata_offset = NumericCast<idx_t>(data_ptr - base_ptr);
+		auto metadata_size = NumericCast<idx_t>(base_ptr + Storage::BLOCK_SIZE - metadata_ptr);
+		auto total_segment_size = metadata_offset + metadata_size;
+		memmove(base_ptr + metadata_offset, metadata_ptr, metadata_size);
+		// store the offset of the end of the metadata, which holds the offset of the first group
+		Store<idx_t>(total_segment_size, base_ptr);
+		handle.Destroy();
+
+		checkpoint_state.FlushSegment(std::move(current_segment), total_segment_size);
+	}
+
+	void Finalize() {
+		state.template Flush<PForDeltaWriter>();
+		FlushSegment();
+		current_segment.reset();
+	}
+};
+
+template <class T>
+unique_ptr<CompressionState> PForDeltaInitCompression(ColumnDataCheckpointer &checkpointer,
+                                                      unique_ptr<AnalyzeState> state) {
+	return make_uniq<PForDeltaCompressState<T>>(checkpointer);
+}
+
+template <class T>
+void PForDeltaCompress(CompressionState &state_p, Vector &scan_vector, idx_t count) {
+	auto &state = state_p.Cast<PForDeltaCompressState<T>>();
+	UnifiedVectorFormat vdata;
+	scan_vector.ToUnifiedFormat(count, vdata);
+	state.Append(vdata, count);
+}
+
+template <class T>
+void PForDeltaFinalizeCompress(CompressionState &state_p) {
+	auto &state = state_p.Cast<PForDeltaCompressState<T>>();
+	state.Finalize();
+}
+
+//===--------------------------------------------------------------------===//
+// Scan
+//===--------------------------------------------------------------------===//
+template <class T>
+struct PForDeltaScanState : public SegmentScanState {
+	using T_U = typename MakeUnsigned<T>::type;
+
+public:
+	explicit PForDeltaScanState(ColumnSegment &segment) : segment(segment), position(0) {
+		auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+		handle = buffer_manager.Pin(segment.block);
+		auto base_ptr = handle.Ptr() + segment.GetBlockOffset();
+		metadata_ptr = base_ptr + Load<idx_t>(base_ptr) - sizeof(pfor_delta_metadata_t);
+	}
+
+	BufferHandle handle;
+	ColumnSegment &segment;
+	//! The offset of the first group, the offsets of the next groups are stored below it
+	data_ptr_t metadata_ptr;
+	//! The row within the segment that is scanned next
+	idx_t position;
+	//! The group that is decoded in the decompression buffer
+	idx_t decoded_group = DConstants::INVALID_INDEX;
+	T_U decompression_buffer[PFOR_DELTA_GROUP_SIZE];
+
+public:
+	idx_t GetGroupCount(idx_t group_idx) const {
+		return MinValue<idx_t>(PFOR_DELTA_GROUP_SIZE, segment.count - group_idx * PFOR_DELTA_GROUP_SIZE);
+	}
+
+	//! Decodes the first count values of the group into the target, which has room for the group rounded up to the
+	//! bitpacking algorithm group size
+	void DecodeGroup(idx_t group_idx, T_U *target, idx_t count) {
+		auto group_offset = Load<pfor_delta_metadata_t>(metadata_ptr - group_idx * sizeof(pfor_delta_metadata_t));
+		auto group_ptr = handle.Ptr() + segment.GetBlockOffset() + group_offset;
+		auto base = Load<T_U>(group_ptr);
+		auto frame_of_reference = Load<T_U>(group_ptr + sizeof(T));
+		auto width = NumericCast<bitpacking_width_t>(Load<uint32_t>(group_ptr + 2 * sizeof(T)));
+		auto exception_count = Load<uint32_t>(group_ptr + 2 * sizeof(T) + sizeof(uint32_t));
+		auto packed_ptr = group_ptr + PForDeltaHeaderSize<T>();
+		auto group_count = GetGroupCount(group_idx);
+
+		// unpack the deltas, we only unpack the algorithm groups that hold the requested values
+		auto unpack_count = BitpackingPrimitives::RoundUpToAlgorithmGroupSize(count);
+		BitpackingPrimitives::UnPackBuffer<T_U>(data_ptr_cast(target), packed_ptr, unpack_count, width, true);
+
+		// patch the exceptions
+		auto exception_positions = packed_ptr + BitpackingPrimitives::GetRequiredSize(group_count, width);
+		auto exception_values = exception_positions + exception_count * sizeof(pfor_delta_exception_position_t);
+		for (idx_t i = 0; i < exception_count; i++) {
+			auto exception_position = Load<pfor_delta_exception_position_t>(
+			    exception_positions + i * sizeof(pfor_delta_exception_position_t));
+			if (exception_position >= count) {
+				break;
+			}
+			target[exception_position] |= Load<T_U>(exception_values + i * sizeof(T_U)) << width;
+		}
+
+		// add the frame of reference: this loop is branch-free so the compiler vectorizes it
+		for (idx_t i = 0; i < count; i++) {
+			target[i] += frame_of_reference;
+		}
+		// and compute the prefix sum of the deltas, unrolled to break the dependency on the loop counter
+		target[0] += base;
+		idx_t i = 1;
+		for (; i + 4 <= count; i += 4) {
+			target[i] += target[i - 1];
+			target[i + 1] += target[i];
+			target[i + 2] += target[i + 1];
+			target[i + 3] += target[i + 2];
+		}
+		for (; i < count; i++) {
+			target[i] += target[i - 1];
+		}
+	}
+
+	void Scan(idx_t scan_count, Vector &result, idx_t result_offset) {
+		auto result_data = FlatVector::GetData<T>(result);
+		result.SetVectorType(VectorType::FLAT_VECTOR);
+
+		idx_t scanned = 0;
+		while (scanned < scan_count) {
+			auto group_idx = position / PFOR_DELTA_GROUP_SIZE;
+			auto offset_in_group = position % PFOR_DELTA_GROUP_SIZE;
+			auto group_count = GetGroupCount(group_idx);
+			auto to_scan = MinValue<idx_t>(scan_count - scanned, group_count - offset_in_group);
+			auto target = reinterpret_cast<T_U *>(result_data + result_offset + scanned);
+			if (offset_in_group == 0 && to_scan == PFOR_DELTA_GROUP_SIZE) {
+				// decode a full group directly into the result vector
+				DecodeGroup(group_idx, target, to_scan);
+			} else {
+				if (decoded_group != group_idx) {
+					DecodeGroup(group_idx, decompression_buffer, group_count);
+					decoded_group = group_idx;
+				}
+				memcpy(target, decompression_buffer + offset_in_group, to_scan * sizeof(T));
+			}
+			scanned += to_scan;
+			position += to_scan;
+		}
+	}
+};
+
+template <class T>
+unique_ptr<SegmentScanState> PForDeltaInitScan(ColumnSegment &segment) {
+	return make_uniq<PForDeltaScanState<T>>(segment);
+}
+
+template <class T>
+void PForDeltaScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                          idx_t result_offset) {
+	auto &scan_state = state.scan_state->Cast<PForDeltaScanState<T>>();
+	scan_state.Scan(scan_count, result, result_offset);
+}
+
+template <class T>
+void PForDeltaScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result) {
+	PForDeltaScanPartial<T>(segment, state, scan_count, result, 0);
+}
+
+//===--------------------------------------------------------------------===//
+// Fetch
+//===--------------------------------------------------------------------===//
+template <class T>
+void PForDeltaFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
+                       idx_t result_idx) {
+	PForDeltaScanState<T> scan_state(segment);
+	auto row = NumericCast<idx_t>(row_id);
+	auto offset_in_group = row % PFOR_DELTA_GROUP_SIZE;
+	// only the values up to the fetched row have to be decoded
+	scan_state.DecodeGroup(row / PFOR_DELTA_GROUP_SIZE, scan_state.decompression_buffer, offset_in_group + 1);
+
+	auto result_data = FlatVector::GetData<T>(result);
+	result_data[result_idx] = static_cast<T>(scan_state.decompression_buffer[offset_in_group]);
+}
+
+template <class T>
+void PForDeltaSkip(ColumnSegment &segment, ColumnScanState &state, idx_t skip_count) {
+	auto &scan_state = state.scan_state->Cast<PForDeltaScanState<T>>();
+	scan_state.position += skip_count;
+}
+
+//===--------------------------------------------------------------------===//
+// Get Function
+//===--------------------------------------------------------------------===//
+template <class T>
+CompressionFunction GetPForDeltaFunction(PhysicalType data_type) {
+	return CompressionFunction(CompressionType::COMPRESSION_PFOR_DELTA, data_type, PForDeltaInitAnalyze<T>,
+	                           PForDeltaAnalyze<T>, PForDeltaFinalAnalyze<T>, PForDeltaInitCompression<T>,
+	                           PForDeltaCompress<T>, PForDeltaFinalizeCompress<T>, PForDeltaInitScan<T>,
+	                           PForDeltaScan<T>, PForDeltaScanPartial<T>, PForDeltaFetchRow<T>, PForDeltaSkip<T>);
+}
+
+CompressionFunction PForDeltaFun::GetFunction(PhysicalType type) {
+	switch (type) {
+	case PhysicalType::INT32:
+		return GetPForDeltaFunction<int32_t>(type);
+	case PhysicalType::INT64:
+		return GetPForDeltaFunction<int64_t>(type);
+	case PhysicalType::UINT32:
+		return GetPForDeltaFunction<uint32_t>(type);
+	case PhysicalType::UINT64:
+		return GetPForDeltaFunction<uint64_t>(type);
+	default:
+		throw InternalException("Unsupported type for PFOR-Delta");
+	}
+}
+
+bool PForDeltaFun::TypeIsSupported(PhysicalType type) {
+	// a group (including all its exceptions) has to fit in a block
+	auto type_size = GetTypeIdSize(type);
+	if ((type_size + sizeof(pfor_delta_exception_position_t)) * PFOR_DELTA_GROUP_SIZE * 2 > Storage::BLOCK_SIZE) {
+		return false;
+	}
+
+	switch (type) {
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+		return true;
+	default:
+		return false;
+	}
+}
+
+} // namespace duckdb
@@ -0,0 +1,507 @@
+#include "duckdb/common/constants.hpp"
+#include "duckdb/function/compression/compression.hpp"
+#include "duckdb/function/compression_function.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/string_uncompressed.hpp"
+#include "duckdb/storage/table/column_data_checkpointer.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
+#include "zstd.h"
+
+namespace duckdb {
+
+//===--------------------------------------------------------------------===//
+// ZSTD
+//===--------------------------------------------------------------------===//
+// The strings of a segment are compressed in frames of up to STANDARD_VECTOR_SIZE rows. A frame holds the lengths of
+// its strings followed by their data, and is compressed as a single ZSTD frame. The frame index at the end of the
+// segment stores the first row and the location of every frame, so scans and fetches only decompress the frames they
+// touch. NULLs are stored as empty strings, their validity is stored separately.
+//
+// Segment layout:
+// [zstd_compression_header_t][frame 0][frame 1]...[zstd_frame_index_entry_t for every frame]
+// Uncompressed frame layout:
+// [uint32_t string lengths][string data]
+
+typedef struct {
+	uint32_t frame_count;
+	uint32_t frame_index_offset;
+} zstd_compression_header_t;
+
+typedef struct {
+	uint32_t row_start;
+	uint32_t offset;
+	uint32_t compressed_size;
+	uint32_t uncompressed_size;
+} zstd_frame_index_entry_t;
+
+struct ZSTDStorage {
+	static constexpr int COMPRESSION_LEVEL = 3;
+	//! Only every ANALYSIS_SAMPLE_INTERVAL-th vector is compressed during analysis to estimate the compression ratio
+	static constexpr idx_t ANALYSIS_SAMPLE_INTERVAL = 4;
+	//! ZSTD has to beat the other string compression methods by a margin, as it decompresses whole frames
+	static constexpr double MINIMUM_COMPRESSION_RATIO = 1.5;
+	//! The estimated size of every string is increased by this amount, as accessing a string decompresses its frame.
+	//! This leaves short strings to dictionary and FSST compression, which can decompress strings individually
+	static constexpr idx_t STRING_ACCESS_OVERHEAD = 2;
+	//! The maximum uncompressed size of a frame, chosen such that any compressed frame fits in an empty segment
+	static constexpr idx_t MAXIMUM_FRAME_SIZE = Storage::BLOCK_SIZE / 2;
+	//! The maximum string size, which is bounded by the frame size
+	static constexpr idx_t MAXIMUM_STRING_SIZE = MAXIMUM_FRAME_SIZE - sizeof(uint32_t);
+
+	static unique_ptr<AnalyzeState> StringInitAnalyze(ColumnData &col_data, PhysicalType type);
+	static bool StringAnalyze(AnalyzeState &state_p, Vector &input, idx_t count);
+	static idx_t StringFinalAnalyze(AnalyzeState &state_p);
+
+	static unique_ptr<CompressionState> InitCompression(ColumnDataCheckpointer &checkpointer,
+	                                                    unique_ptr<AnalyzeState> analyze_state_p);
+	static void Compress(CompressionState &state_p, Vector &scan_vector, idx_t count);
+	static void FinalizeCompress(CompressionState &state_p);
+
+	static unique_ptr<SegmentScanState> StringInitScan(ColumnSegment &segment);
+	static void StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+	                              idx_t result_offset);
+	static void StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result);
+	static void StringFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
+	                           idx_t result_idx);
+};
+
+//! Collects the strings of a frame until it is compressed
+struct ZSTDFrame {
+	vector<uint32_t> lengths;
+	vector<char> data;
+	vector<bool> validity;
+	//! Buffer holding the uncompressed frame
+	vector<data_t> serialized;
+
+	idx_t Count() const {
+		return lengths.size();
+	}
+
+	idx_t UncompressedSize() const {
+		return lengths.size() * sizeof(uint32_t) + data.size();
+	}
+
+	bool CanAppend(idx_t string_size) const {
+		return Count() < STANDARD_VECTOR_SIZE &&
+		       UncompressedSize() + sizeof(uint32_t) + string_size <= ZSTDStorage::MAXIMUM_FRAME_SIZE;
+	}
+
+	void Append(const string_t &str, bool is_valid) {
+		auto size = str.GetSize();
+		lengths.push_back(NumericCast<uint32_t>(size));
+		data.insert(data.end(), str.GetData(), str.GetData() + size);
+		validity.push_back(is_valid);
+	}
+
+	void Reset() {
+		lengths.clear();
+		data.clear();
+		validity.clear();
+	}
+
+	//! Compresses the frame into the target, which has room for ZSTD_compressBound(MAXIMUM_FRAME_SIZE) bytes
+	idx_t Compress(duckdb_zstd::ZSTD_CCtx *context, data_ptr_t target) {
+		auto uncompressed_size = UncompressedSize();
+		serialized.resize(uncompressed_size);
+		memcpy(serialized.data(), lengths.data(), lengths.size() * sizeof(uint32_t));
+		if (!data.empty()) {
+			memcpy(serialized.data() + lengths.size() * sizeof(uint32_t), data.data(), data.size());
+		}
+		auto capacity = duckdb_zstd::ZSTD_compressBound(ZSTDStorage::MAXIMUM_FRAME_SIZE);
+		auto compressed_size = duckdb_zstd::ZSTD_compressCCtx(context, target, capacity, serialized.data(),
+		                                                      uncompressed_size, ZSTDStorage::COMPRESSION_LEVEL);
+		if (duckdb_zstd::ZSTD_isError(compressed_size)) {
+			throw InternalException("ZSTD compression failed: %s", duckdb_zstd::ZSTD_getErrorName(compressed_size));
+		}
+		return compressed_size;
+	}
+};
+
+//===--------------------------------------------------------------------===//
+// Analyze
+//===--------------------------------------------------------------------===//
+struct ZSTDAnalyzeState : public AnalyzeState {
+	ZSTDAnalyzeState()
+	    : context(duckdb_zstd::ZSTD_createCCtx()),
+	      compression_buffer(duckdb_zstd::ZSTD_compressBound(ZSTDStorage::MAXIMUM_FRAME_SIZE)) {
+	}
+
+	~ZSTDAnalyzeState() override {
+		duckdb_zstd::ZSTD_freeCCtx(context);
+	}
+
+	duckdb_zstd::ZSTD_CCtx *context;
+	vector<data_t> compression_buffer;
+	ZSTDFrame frame;
+
+	idx_t vector_count = 0;
+	idx_t string_count = 0;
+	idx_t frame_count = 0;
+	//! The uncompressed size of all frames
+	idx_t total_size = 0;
+	//! The uncompressed and compressed size of the sampled frames
+	idx_t sampled_size = 0;
+	idx_t sampled_compressed_size = 0;
+
+	void CompressSample() {
+		if (frame.Count() == 0) {
+			return;
+		}
+		sampled_size += frame.UncompressedSize();
+		sampled_compressed_size += frame.Compress(context, compression_buffer.data());
+		frame.Reset();
+	}
+};
+
+unique_ptr<AnalyzeState> ZSTDStorage::StringInitAnalyze(ColumnData &col_data, PhysicalType type) {
+	return make_uniq<ZSTDAnalyzeState>();
+}
+
+bool ZSTDStorage::StringAnalyze(AnalyzeState &state_p, Vector &input, idx_t count) {
+	auto &state = state_p.Cast<ZSTDAnalyzeState>();
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+	auto data = UnifiedVectorFormat::GetData<string_t>(vdata);
+
+	bool sample_selected = state.vector_count % ANALYSIS_SAMPLE_INTERVAL == 0;
+	state.vector_count++;
+
+	idx_t vector_size = 0;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		auto is_valid = vdata.validity.RowIsValid(idx);
+		auto str = is_valid ? data[idx] : string_t(nullptr, 0);
+		auto string_size = str.GetSize();
+		if (string_size > MAXIMUM_STRING_SIZE) {
+			return false;
+		}
+		state.string_count++;
+		vector_size += sizeof(uint32_t) + string_size;
+		if (sample_selected) {
+			if (!state.frame.CanAppend(string_size)) {
+				state.CompressSample();
+			}
+			state.frame.Append(str, is_valid);
+		}
+	}
+	state.CompressSample();
+	state.total_size += vector_size;
+	// every vector starts a new frame, and large vectors are split over multiple frames
+	state.frame_count += 1 + vector_size / MAXIMUM_FRAME_SIZE;
+	return true;
+}
+
+idx_t ZSTDStorage::StringFinalAnalyze(AnalyzeState &state_p) {
+	auto &state = state_p.Cast<ZSTDAnalyzeState>();
+	if (state.sampled_size == 0) {
+		return DConstants::INVALID_INDEX;
+	}
+	auto compression_ratio = static_cast<double>(state.sampled_compressed_size) / state.sampled_size;
+	auto estimated_data_size = static_cast<double>(state.total_size) * compression_ratio;
+	auto estimated_index_size = state.frame_count * sizeof(zstd_frame_index_entry_t);
+	auto num_blocks = estimated_data_size / Storage::BLOCK_SIZE + 1;
+	auto estimated_size = estimated_data_size + static_cast<double>(estimated_index_size) +
+	                      num_blocks * sizeof(zstd_compression_header_t);
+
+	return NumericCast<idx_t>(estimated_size * MINIMUM_COMPRESSION_RATIO +
+	                          static_cast<double>(state.string_count * STRING_ACCESS_OVERHEAD));
+}
+
+//===--------------------------------------------------------------------===//
+// Compress
+//===--------------------------------------------------------------------===//
+class ZSTDCompressionState : public CompressionState {
+public:
+	explicit ZSTDCompressionState(ColumnDataCheckpointer &checkpointer)
+	    : checkpointer(checkpointer), function(checkpointer.GetCompressionFunction(CompressionType::COMPRESSION_ZSTD)),
+	      context(duckdb_zstd::ZSTD_createCCtx()),
+	      compression_buffer(duckdb_zstd::ZSTD_compressBound(ZSTDStorage::MAXIMUM_FRAME_SIZE)) {
+		CreateEmptySegment(checkpointer.GetRowGroup().start);
+	}
+
+	~ZSTDCompressionState() override {
+		duckdb_zstd::ZSTD_freeCCtx(context);
+	}
+
+	ColumnDataCheckpointer &checkpointer;
+	CompressionFunction &function;
+
+	// State regarding current segment
+	unique_ptr<ColumnSegment> current_segment;
+	BufferHandle current_handle;
+	//! The offset of the next frame in the current segment
+	idx_t data_offset;
+	vector<zstd_frame_index_entry_t> frame_index;
+
+	// The frame that is being collected
+	ZSTDFrame frame;
+	duckdb_zstd::ZSTD_CCtx *context;
+	vector<data_t> compression_buffer;
+
+public:
+	void CreateEmptySegment(idx_t row_start) {
+		auto &db = checkpointer.GetDatabase();
+		auto &type = checkpointer.GetType();
+		auto compressed_segment = ColumnSegment::CreateTransientSegment(db, type, row_start);
+		current_segment = std::move(compressed_segment);
+		current_segment->function = function;
+
+		auto &buffer_manager = BufferManager::GetBufferManager(db);
+		current_handle = buffer_manager.Pin(current_segment->block);
+		data_offset = sizeof(zstd_compression_header_t);
+		frame_index.clear();
+	}
+
+	bool HasEnoughSpace(idx_t compressed_size) {
+		auto index_size = (frame_index.size() + 1) * sizeof(zstd_frame_index_entry_t);
+		return data_offset + compressed_size + index_size <= Storage::BLOCK_SIZE;
+	}
+
+	void Append(const string_t &str, bool is_valid) {
+		if (!frame.CanAppend(str.GetSize())) {
+			FlushFrame();
+		}
+		frame.Append(str, is_valid);
+	}
+
+	void FlushFrame() {
+		if (frame.Count() == 0) {
+			return;
+		}
+		auto compressed_size = frame.Compress(context, compression_buffer.data());
+		if (!HasEnoughSpace(compressed_size)) {
+			auto row_start = current_segment->start + current_segment->count;
+			FlushSegment();
+			CreateEmptySegment(row_start);
+			if (!HasEnoughSpace(compressed_size)) {
+				throw InternalException("ZSTD string compression failed due to insufficient space in empty block");
+			}
+		}
+		memcpy(current_handle.Ptr() + data_offset, compression_buffer.data(), compressed_size);
+
+		zstd_frame_index_entry_t entry;
+		entry.row_start = NumericCast<uint32_t>(current_segment->count.load());
+		entry.offset = NumericCast<uint32_t>(data_offset);
+		entry.compressed_size = NumericCast<uint32_t>(compressed_size);
+		entry.uncompressed_size = NumericCast<uint32_t>(frame.UncompressedSize());
+		frame_index.push_back(entry);
+
+		// the strings only end up in the statistics of the segment that holds their frame
+		idx_t string_offset = 0;
+		for (idx_t i = 0; i < frame.Count(); i++) {
+			if (frame.validity[i]) {
+				string_t str(frame.data.data() + string_offset, frame.lengths[i]);
+				UncompressedStringStorage::UpdateStringStats(current_segment->stats, str);
+			}
+			string_offset += frame.lengths[i];
+		}
+
+		current_segment->count += frame.Count();
+		data_offset += compressed_size;
+		frame.Reset();
+	}
+
+	void FlushSegment() {
+		auto base_ptr = current_handle.Ptr();
+		// write the frame index directly after the frames
+		for (idx_t i = 0; i < frame_index.size(); i++) {
+			auto entry_ptr = base_ptr + data_offset + i * sizeof(zstd_frame_index_entry_t);
+			Store<zstd_frame_index_entry_t>(frame_index[i], entry_ptr);
+		}
+		auto header_ptr = reinterpret_cast<zstd_compression_header_t *>(base_ptr);
+		Store<uint32_t>(NumericCast<uint32_t>(frame_index.size()), data_ptr_cast(&header_ptr->frame_count));
+		Store<uint32_t>(NumericCast<uint32_t>(data_offset), data_ptr_cast(&header_ptr->frame_index_offset));
+		auto total_size = data_offset + frame_index.size() * sizeof(zstd_frame_index_entry_t);
+		current_handle.Destroy();
+
+		auto &state = checkpointer.GetCheckpointState();
+		state.FlushSegment(std::move(current_segment), total_size);
+	}
+
+	void Finalize() {
+		FlushFrame();
+		FlushSegment();
+		current_segment.reset();
+	}
+};
+
+unique_ptr<CompressionState> ZSTDStorage::InitCompression(ColumnDataCheckpointer &checkpointer,
+                                                          unique_ptr<AnalyzeState> analyze_state_p) {
+	return make_uniq<ZSTDCompressionState>(checkpointer);
+}
+
+void ZSTDStorage::Compress(CompressionState &state_p, Vector &scan_vector, idx_t count) {
+	auto &state = state_p.Cast<ZSTDCompressionState>();
+	UnifiedVectorFormat vdata;
+	scan_vector.ToUnifiedFormat(count, vdata);
+	auto data = UnifiedVectorFormat::GetData<string_t>(vdata);
+
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(idx)) {
+			state.Append(string_t(nullptr, 0), false);
+		} else {
+			state.Append(data[idx], true);
+		}
+	}
+	// frames do not span vectors, so the frame index has an entry for every vector
+	state.FlushFrame();
+}
+
+void ZSTDStorage::FinalizeCompress(CompressionState &state_p) {
+	auto &state = state_p.Cast<ZSTDCompressionState>();
+	state.Finalize();
+}
+
+//===--------------------------------------------------------------------===//
+// Scan
+//===--------------------------------------------------------------------===//
+struct ZSTDScanState : public StringScanState {
+public:
+	explicit ZSTDScanState(ColumnSegment &segment) : segment(segment), context(duckdb_zstd::ZSTD_createDCtx()) {
+		auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+		handle = buffer_manager.Pin(segment.block);
+		auto base_ptr = handle.Ptr() + segment.GetBlockOffset();
+		auto header_ptr = reinterpret_cast<zstd_compression_header_t *>(base_ptr);
+		frame_count = Load<uint32_t>(data_ptr_cast(&header_ptr->frame_count));
+		frame_index_ptr = base_ptr + Load<uint32_t>(data_ptr_cast(&header_ptr->frame_index_offset));
+	}
+
+	~ZSTDScanState() override {
+		duckdb_zstd::ZSTD_freeDCtx(context);
+	}
+
+	ColumnSegment &segment;
+	duckdb_zstd::ZSTD_DCtx *context;
+	idx_t frame_count;
+	data_ptr_t frame_index_ptr;
+
+	// The frame that is currently decompressed
+	idx_t current_frame = DConstants::INVALID_INDEX;
+	idx_t frame_row_start = 0;
+	idx_t frame_row_end = 0;
+	vector<data_t> decompression_buffer;
+	//! The offsets of the strings of the current frame in the decompression buffer
+	vector<idx_t> string_offsets;
+
+public:
+	zstd_frame_index_entry_t GetFrameEntry(idx_t frame_idx) const {
+		return Load<zstd_frame_index_entry_t>(frame_index_ptr + frame_idx * sizeof(zstd_frame_index_entry_t));
+	}
+
+	//! Returns the frame that holds the given row
+	idx_t FindFrame(idx_t row) const {
+		idx_t lower = 0;
+		idx_t upper = frame_count;
+		while (upper - lower > 1) {
+			auto middle = lower + (upper - lower) / 2;
+			if (GetFrameEntry(middle).row_start <= row) {
+				lower = middle;
+			} else {
+				upper = middle;
+			}
+		}
+		return lower;
+	}
+
+	void LoadFrame(idx_t row) {
+		if (current_frame != DConstants::INVALID_INDEX && row >= frame_row_start && row < frame_row_end) {
+			return;
+		}
+		auto frame_idx = FindFrame(row);
+		auto entry = GetFrameEntry(frame_idx);
+		frame_row_start = entry.row_start;
+		if (frame_idx + 1 < frame_count) {
+			frame_row_end = GetFrameEntry(frame_idx + 1).row_start;
+		} else {
+			frame_row_end = segment.count;
+		}
+
+		decompression_buffer.resize(entry.uncompressed_size);
+		auto base_ptr = handle.Ptr() + segment.GetBlockOffset();
+		auto decompressed_size =
+		    duckdb_zstd::ZSTD_decompressDCtx(context, decompression_buffer.data(), decompression_buffer.size(),
+		                                     base_ptr + entry.offset, entry.compressed_size);
+		if (duckdb_zstd::ZSTD_isError(decompressed_size) || decompressed_size != entry.uncompressed_size) {
+			throw IOException("Failed to decompress ZSTD frame of column segment");
+		}
+
+		auto string_count = frame_row_end - frame_row_start;
+		string_offsets.resize(string_count);
+		idx_t string_offset = string_count * sizeof(uint32_t);
+		for (idx_t i = 0; i < string_count; i++) {
+			string_offsets[i] = string_offset;
+			string_offset += Load<uint32_t>(decompression_buffer.data() + i * sizeof(uint32_t));
+		}
+		current_frame = frame_idx;
+	}
+
+	//! Copies the string of a row of the current frame into the result vector
+	string_t FetchString(Vector &result, idx_t row) {
+		auto frame_row = row - frame_row_start;
+		auto length = Load<uint32_t>(decompression_buffer.data() + frame_row * sizeof(uint32_t));
+		if (length == 0) {
+			return string_t(nullptr, 0);
+		}
+		auto str_ptr = const_char_ptr_cast(decompression_buffer.data() + string_offsets[frame_row]);
+		return StringVector::AddStringOrBlob(result, str_ptr, length);
+	}
+};
+
+unique_ptr<SegmentScanState> ZSTDStorage::StringInitScan(ColumnSegment &segment) {
+	return make_uniq<ZSTDScanState>(segment);
+}
+
+void ZSTDStorage::StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                                    idx_t result_offset) {
+	auto &scan_state = state.scan_state->Cast<ZSTDScanState>();
+	auto start = segment.GetRelativeIndex(state.row_index);
+	auto result_data = FlatVector::GetData<string_t>(result);
+
+	idx_t scanned = 0;
+	while (scanned < scan_count) {
+		auto row = start + scanned;
+		scan_state.LoadFrame(row);
+		auto to_scan = MinValue<idx_t>(scan_count - scanned, scan_state.frame_row_end - row);
+		for (idx_t i = 0; i < to_scan; i++) {
+			result_data[result_offset + scanned + i] = scan_state.FetchString(result, row + i);
+		}
+		scanned += to_scan;
+	}
+}
+
+void ZSTDStorage::StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result) {
+	StringScanPartial(segment, state, scan_count, result, 0);
+}
+
+//===--------------------------------------------------------------------===//
+// Fetch
+//===--------------------------------------------------------------------===//
+void ZSTDStorage::StringFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
+                                 idx_t result_idx) {
+	ZSTDScanState scan_state(segment);
+	auto row = NumericCast<idx_t>(row_id);
+	scan_state.LoadFrame(row);
+
+	auto result_data = FlatVector::GetData<string_t>(result);
+	result_data[result_idx] = scan_state.FetchString(result, row);
+}
+
+//===--------------------------------------------------------------------===//
+// Get Function
+//===--------------------------------------------------------------------===//
+CompressionFunction ZSTDFun::GetFunction(PhysicalType data_type) {
+	D_ASSERT(data_type == PhysicalType::VARCHAR);
+	return CompressionFunction(
+	    CompressionType::COMPRESSION_ZSTD, data_type, ZSTDStorage::StringInitAnalyze, ZSTDStorage::StringAnalyze,
+	    ZSTDStorage::StringFinalAnalyze, ZSTDStorage::InitCompression, ZSTDStorage::Compress,
+	    ZSTDStorage::FinalizeCompress, ZSTDStorage::StringInitScan, ZSTDStorage::StringScan,
+	    ZSTDStorage::StringScanPartial, ZSTDStorage::StringFetchRow, UncompressedFunctions::EmptySkip);
+}
+
+bool ZSTDFun::TypeIsSupported(PhysicalType type) {
+	return type == PhysicalType::VARCHAR;
+}
+
+} // namespace duckdb
@@ -52,7 +52,7 @@ DataTable::DataTable(AttachedDatabase &db, shared_ptr<TableIOManager> table_io_m
 	auto types = GetTypes();
 	this->row_groups =
 	    make_shared_ptr<RowGroupCollection>(info, TableIOManager::Get(*this).GetBlockManagerForRowData(), types, 0);
-	if (data && data->row_group_count > 0) {
+	if (data && (data->row_group_count > 0 || data->table_pointer.IsValid())) {
 		this->row_groups->Initialize(*data);
 	} else {
 		this->row_groups->InitializeEmpty();
@@ -344,6 +344,21 @@ void DataTableInfo::SetTableName(string name) {
 	table = std::move(name);
 }
 
+bool DataTableInfo::GetCachedCompression(const vector<idx_t> &column_path, CachedCompressionMethod &result) {
+	lock_guard<mutex> l(compression_cache_lock);
+	auto entry = compression_cache.find(column_path);
+	if (entry == compression_cache.end()) {
+		return false;
+	}
+	result = entry->second;
+	return true;
+}
+
+void DataTableInfo::SetCachedCompression(const vector<idx_t> &column_path, const CachedCompressionMethod &method) {
+	lock_guard<mutex> l(compression_cache_lock);
+	compression_cache[column_path] = method;
+}
+
 string DataTable::GetTableName() const {
 	return info->GetTableName();
 }
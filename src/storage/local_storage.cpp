@@ -353,14 +353,16 @@ void LocalStorage::InitializeAppend(LocalAppendState &state, DataTable &table) {
 	state.storage->row_groups->InitializeAppend(TransactionData(transaction), state.append_state);
 }
 
-void LocalStorage::Append(LocalAppendState &state, DataChunk &chunk) {
+void LocalStorage::Append(LocalAppendState &state, DataChunk &chunk, bool append_to_indexes) {
 	// append to unique indices (if any)
 	auto storage = state.storage;
-	idx_t base_id =
-	    NumericCast<idx_t>(MAX_ROW_ID) + storage->row_groups->GetTotalRows() + state.append_state.total_append_count;
-	auto error = DataTable::AppendToIndexes(storage->indexes, chunk, NumericCast<row_t>(base_id));
-	if (error.HasError()) {
-		error.Throw();
+	if (append_to_indexes) {
+		idx_t base_id = NumericCast<idx_t>(MAX_ROW_ID) + storage->row_groups->GetTotalRows() +
+		                state.append_state.total_append_count;
+		auto error = DataTable::AppendToIndexes(storage->indexes, chunk, NumericCast<row_t>(base_id));
+		if (error.HasError()) {
+			error.Throw();
+		}
 	}
 
 	//! Append the chunk to the local storage
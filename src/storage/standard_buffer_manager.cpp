@@ -412,6 +412,7 @@ vector<TemporaryFileInformation> StandardBufferManager::GetTemporaryFiles() {
 		info.path = name;
 		auto handle = fs.OpenFile(name, FileFlags::FILE_FLAGS_READ);
 		info.size = NumericCast<idx_t>(fs.GetFileSize(*handle));
+		info.uncompressed_size = info.size;
 		handle.reset();
 		result.push_back(info);
 	});
@@ -218,6 +218,10 @@ class SingleFileStorageCommitState : public StorageCommitState {
 	idx_t initial_written = 0;
 	optional_ptr<WriteAheadLog> log;
 	bool checkpoint;
+	//! The WAL that has to be synced to make the commit durable (if any)
+	optional_ptr<WriteAheadLog> sync_log;
+	//! The position up to which the WAL has to be synced
+	idx_t sync_position = 0;
 
 public:
 	SingleFileStorageCommitState(StorageManager &storage_manager, bool checkpoint);
@@ -233,8 +237,10 @@ public:
 		}
 	}
 
-	// Make the commit persistent
+	// Write the commit to the WAL
 	void FlushCommit() override;
+	// Sync the WAL up to the commit
+	void SyncCommit() override;
 };
 
 SingleFileStorageCommitState::SingleFileStorageCommitState(StorageManager &storage_manager, bool checkpoint)
@@ -256,7 +262,7 @@ SingleFileStorageCommitState::SingleFileStorageCommitState(StorageManager &stora
 	}
 }
 
-// Make the commit persistent
+// Write the commit to the WAL
 void SingleFileStorageCommitState::FlushCommit() {
 	if (log) {
 		// flush the WAL if any changes were made
@@ -264,7 +270,8 @@ void SingleFileStorageCommitState::FlushCommit() {
 			(void)checkpoint;
 			D_ASSERT(!checkpoint);
 			D_ASSERT(!log->skip_writing);
-			log->Flush();
+			sync_position = log->WriteFlush();
+			sync_log = log;
 		}
 		log->skip_writing = false;
 	}
@@ -272,6 +279,15 @@ void SingleFileStorageCommitState::FlushCommit() {
 	log = nullptr;
 }
 
+// Sync the WAL up to the commit
+void SingleFileStorageCommitState::SyncCommit() {
+	if (!sync_log) {
+		return;
+	}
+	sync_log->Sync(sync_position);
+	sync_log = nullptr;
+}
+
 unique_ptr<StorageCommitState> SingleFileStorageManager::GenStorageCommitState(Transaction &transaction,
                                                                                bool checkpoint) {
 	return make_uniq<SingleFileStorageCommitState>(*this, checkpoint);
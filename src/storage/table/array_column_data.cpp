@@ -24,6 +24,10 @@ void ArrayColumnData::SetStart(idx_t new_start) {
 	validity.SetStart(new_start);
 }
 
+bool ArrayColumnData::HasChanges() {
+	return ColumnData::HasChanges() || validity.HasChanges() || child_column->HasChanges();
+}
+
 bool ArrayColumnData::CheckZonemap(ColumnScanState &state, TableFilter &filter) {
 	// FIXME: There is nothing preventing us from supporting this, but it's not implemented yet.
 	// table filters are not supported yet for fixed size list columns
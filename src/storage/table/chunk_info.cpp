@@ -113,11 +113,47 @@ unique_ptr<ChunkInfo> ChunkConstantInfo::Read(ReadStream &reader) {
 // Vector info
 //===--------------------------------------------------------------------===//
 ChunkVectorInfo::ChunkVectorInfo(idx_t start)
-    : ChunkInfo(start, ChunkInfoType::VECTOR_INFO), insert_id(0), same_inserted_id(true), any_deleted(false) {
+    : ChunkInfo(start, ChunkInfoType::VECTOR_INFO), insert_id(0), same_inserted_id(true), any_deleted(false),
+      max_committed_delete_id(0), uncommitted_delete_count(0) {
 	for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; i++) {
 		inserted[i] = 0;
 		deleted[i] = NOT_DELETED_ID;
 	}
+	for (idx_t i = 0; i < ValidityMask::STANDARD_ENTRY_COUNT; i++) {
+		committed_deletes[i] = 0;
+	}
+}
+
+template <class OP>
+bool ChunkVectorInfo::DeletesAreCommitted(transaction_t start_time, transaction_t transaction_id) const {
+	// if every delete has been committed and the most recent delete is visible to this transaction
+	// all deletes are visible - the committed_deletes bitmap then determines which tuples are deleted
+	return uncommitted_delete_count == 0 && !OP::UseDeletedVersion(start_time, transaction_id, max_committed_delete_id);
+}
+
+idx_t ChunkVectorInfo::GetCommittedDeletesSelVector(SelectionVector &sel_vector, idx_t max_count) const {
+	idx_t count = 0;
+	for (idx_t base_idx = 0, entry_idx = 0; base_idx < max_count;
+	     base_idx += ValidityMask::BITS_PER_VALUE, entry_idx++) {
+		auto entry = committed_deletes[entry_idx];
+		idx_t next = MinValue<idx_t>(base_idx + ValidityMask::BITS_PER_VALUE, max_count);
+		if (entry == 0) {
+			// nothing deleted in this entry
+			for (idx_t i = base_idx; i < next; i++) {
+				sel_vector.set_index(count++, i);
+			}
+		} else if (entry == ~validity_t(0)) {
+			// everything deleted in this entry
+			continue;
+		} else {
+			// write every index and only advance past the indexes that were not deleted
+			for (idx_t i = base_idx; i < next; i++) {
+				sel_vector.set_index(count, i);
+				count += ((entry >> (i - base_idx)) & 1) ^ 1;
+			}
+		}
+	}
+	return count;
 }
 
 template <class OP>
@@ -135,6 +171,9 @@ idx_t ChunkVectorInfo::TemplatedGetSelVector(transaction_t start_time, transacti
 		if (!OP::UseInsertedVersion(start_time, transaction_id, insert_id)) {
 			return 0;
 		}
+		if (DeletesAreCommitted<OP>(start_time, transaction_id)) {
+			return GetCommittedDeletesSelVector(sel_vector, max_count);
+		}
 		// have to check deleted flag
 		for (idx_t i = 0; i < max_count; i++) {
 			if (OP::UseDeletedVersion(start_time, transaction_id, deleted[i])) {
@@ -148,6 +187,13 @@ idx_t ChunkVectorInfo::TemplatedGetSelVector(transaction_t start_time, transacti
 				sel_vector.set_index(count++, i);
 			}
 		}
+	} else if (DeletesAreCommitted<OP>(start_time, transaction_id)) {
+		// have to check inserted flag - the deletes are given by the bitmap
+		for (idx_t i = 0; i < max_count; i++) {
+			if (OP::UseInsertedVersion(start_time, transaction_id, inserted[i]) && !IsCommittedDelete(i)) {
+				sel_vector.set_index(count++, i);
+			}
+		}
 	} else {
 		// have to check both flags
 		for (idx_t i = 0; i < max_count; i++) {
@@ -196,18 +242,33 @@ idx_t ChunkVectorInfo::Delete(transaction_t transaction_id, row_t rows[], idx_t
 		rows[deleted_tuples] = rows[i];
 		deleted_tuples++;
 	}
+	uncommitted_delete_count += deleted_tuples;
 	return deleted_tuples;
 }
 
 void ChunkVectorInfo::CommitDelete(transaction_t commit_id, const DeleteInfo &info) {
-	if (info.is_consecutive) {
-		for (idx_t i = 0; i < info.count; i++) {
-			deleted[i] = commit_id;
-		}
+	// commit_id is either a commit id (commit), a transaction id (revert of a commit) or NOT_DELETED_ID (rollback)
+	bool is_committed = commit_id < TRANSACTION_ID_START;
+	if (is_committed) {
+		D_ASSERT(uncommitted_delete_count >= info.count);
+		uncommitted_delete_count -= info.count;
+		max_committed_delete_id = MaxValue<transaction_t>(max_committed_delete_id, commit_id);
+	} else if (commit_id == NOT_DELETED_ID) {
+		D_ASSERT(uncommitted_delete_count >= info.count);
+		uncommitted_delete_count -= info.count;
 	} else {
-		auto rows = info.GetRows();
-		for (idx_t i = 0; i < info.count; i++) {
-			deleted[rows[i]] = commit_id;
+		uncommitted_delete_count += info.count;
+	}
+	auto rows = info.is_consecutive ? nullptr : info.GetRows();
+	for (idx_t i = 0; i < info.count; i++) {
+		idx_t row = rows ? rows[i] : i;
+		deleted[row] = commit_id;
+		auto entry_idx = row / ValidityMask::BITS_PER_VALUE;
+		auto bit = validity_t(1) << (row % ValidityMask::BITS_PER_VALUE);
+		if (is_committed) {
+			committed_deletes[entry_idx] |= bit;
+		} else {
+			committed_deletes[entry_idx] &= ~bit;
 		}
 	}
 }
@@ -286,6 +347,8 @@ unique_ptr<ChunkInfo> ChunkVectorInfo::Read(ReadStream &reader) {
 	for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; i++) {
 		if (mask.RowIsValid(i)) {
 			result->deleted[i] = 0;
+			result->committed_deletes[i / ValidityMask::BITS_PER_VALUE] |=
+			    validity_t(1) << (i % ValidityMask::BITS_PER_VALUE);
 		}
 	}
 	return std::move(result);
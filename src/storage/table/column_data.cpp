@@ -62,6 +62,25 @@ bool ColumnData::HasUpdates() const {
 	return updates.get();
 }
 
+bool ColumnData::HasUpdates(idx_t start_row, idx_t end_row) const {
+	lock_guard<mutex> update_guard(update_lock);
+	return updates && updates->HasUpdates(start_row, end_row);
+}
+
+bool ColumnData::HasChanges() {
+	if (HasUpdates()) {
+		return true;
+	}
+	auto l = data.Lock();
+	for (auto segment = data.GetRootSegment(l); segment; segment = data.GetNextSegment(l, segment)) {
+		if (segment->segment_type == ColumnSegmentType::TRANSIENT) {
+			// transient segment: the data has not been written to disk yet
+			return true;
+		}
+	}
+	return false;
+}
+
 void ColumnData::ClearUpdates() {
 	lock_guard<mutex> update_guard(update_lock);
 	updates.reset();
@@ -92,9 +111,9 @@ void ColumnData::InitializeScanWithOffset(ColumnScanState &state, idx_t row_idx)
 }
 
 ScanVectorType ColumnData::GetVectorScanType(ColumnScanState &state, idx_t scan_count) {
-	if (HasUpdates()) {
-		// if we have updates we need to merge in the updates
-		// always need to scan flat vectors
+	// only the vectors that have updates need to be scanned as flat vectors - the updates are merged into them
+	auto offset_in_column = state.row_index - start;
+	if (scan_count > 0 && HasUpdates(offset_in_column, offset_in_column + scan_count - 1)) {
 		return ScanVectorType::SCAN_FLAT_VECTOR;
 	}
 	// check if the current segment has enough data remaining
@@ -170,7 +189,8 @@ unique_ptr<BaseStatistics> ColumnData::GetUpdateStatistics() {
 void ColumnData::FetchUpdates(TransactionData transaction, idx_t vector_index, Vector &result, idx_t scan_count,
                               bool allow_updates, bool scan_committed) {
 	lock_guard<mutex> update_guard(update_lock);
-	if (!updates) {
+	if (!updates || !updates->HasUpdates(vector_index)) {
+		// no updates to this vector: we don't need to flatten the result
 		return;
 	}
 	if (!allow_updates && updates->HasUncommittedUpdates(vector_index)) {
@@ -40,27 +40,56 @@ ColumnCheckpointState &ColumnDataCheckpointer::GetCheckpointState() {
 	return state;
 }
 
-void ColumnDataCheckpointer::ScanSegments(const std::function<void(Vector &, idx_t)> &callback) {
+void ColumnDataCheckpointer::ScanSegments(const std::function<void(Vector &, idx_t)> &callback, idx_t sample_interval) {
 	Vector scan_vector(intermediate.GetType(), nullptr);
+	idx_t vector_idx = 0;
 	for (idx_t segment_idx = 0; segment_idx < nodes.size(); segment_idx++) {
 		auto &segment = *nodes[segment_idx].node;
 		ColumnScanState scan_state;
 		scan_state.current = &segment;
 		segment.InitializeScan(scan_state);
+		scan_state.internal_index = segment.start;
 
-		for (idx_t base_row_index = 0; base_row_index < segment.count; base_row_index += STANDARD_VECTOR_SIZE) {
+		for (idx_t base_row_index = 0; base_row_index < segment.count;
+		     base_row_index += STANDARD_VECTOR_SIZE, vector_idx++) {
+			if (vector_idx % sample_interval != 0) {
+				// this vector is not part of the sample
+				continue;
+			}
 			scan_vector.Reference(intermediate);
 
 			idx_t count = MinValue<idx_t>(segment.count - base_row_index, STANDARD_VECTOR_SIZE);
 			scan_state.row_index = segment.start + base_row_index;
+			if (scan_state.internal_index < scan_state.row_index) {
+				// skip over the vectors that were not part of the sample
+				segment.Skip(scan_state);
+			}
 
 			col_data.CheckpointScan(segment, scan_state, row_group.start, count, scan_vector);
+			scan_state.internal_index = scan_state.row_index + count;
 
 			callback(scan_vector, count);
 		}
 	}
 }
 
+idx_t ColumnDataCheckpointer::GetRowCount() const {
+	idx_t row_count = 0;
+	for (auto &node : nodes) {
+		row_count += node.node->count;
+	}
+	return row_count;
+}
+
+vector<idx_t> ColumnDataCheckpointer::GetColumnPath() const {
+	vector<idx_t> column_path;
+	for (optional_ptr<ColumnData> column = &col_data; column; column = column->parent) {
+		column_path.push_back(column->column_index);
+	}
+	std::reverse(column_path.begin(), column_path.end());
+	return column_path;
+}
+
 CompressionType ForceCompression(vector<optional_ptr<CompressionFunction>> &compression_functions,
                                  CompressionType compression_type) {
 // On of the force_compression flags has been set
@@ -95,64 +124,67 @@ CompressionType ForceCompression(vector<optional_ptr<CompressionFunction>> &comp
 	return found ? compression_type : CompressionType::COMPRESSION_AUTO;
 }
 
-unique_ptr<AnalyzeState> ColumnDataCheckpointer::DetectBestCompressionMethod(idx_t &compression_idx) {
-	D_ASSERT(!compression_functions.empty());
-	auto &config = DBConfig::GetConfig(GetDatabase());
-	CompressionType forced_method = CompressionType::COMPRESSION_AUTO;
-
-	auto compression_type = checkpoint_info.GetCompressionType();
-	if (compression_type != CompressionType::COMPRESSION_AUTO) {
-		forced_method = ForceCompression(compression_functions, compression_type);
-	}
-	if (compression_type == CompressionType::COMPRESSION_AUTO &&
-	    config.options.force_compression != CompressionType::COMPRESSION_AUTO) {
-		forced_method = ForceCompression(compression_functions, config.options.force_compression);
+//! Returns the serialization version from which on the segments of the compression method can be read
+static idx_t CompressionSerializationVersion(CompressionType compression_type) {
+	switch (compression_type) {
+	case CompressionType::COMPRESSION_PFOR_DELTA:
+	case CompressionType::COMPRESSION_ZSTD:
+		return 2;
+	default:
+		return 1;
 	}
+}
+
+unique_ptr<AnalyzeState> ColumnDataCheckpointer::AnalyzeCompressionMethods(
+    vector<optional_ptr<CompressionFunction>> &candidates, CompressionType forced_method, idx_t sample_interval,
+    idx_t &compression_idx, idx_t &best_score) {
 	// set up the analyze states for each compression method
 	vector<unique_ptr<AnalyzeState>> analyze_states;
-	analyze_states.reserve(compression_functions.size());
-	for (idx_t i = 0; i < compression_functions.size(); i++) {
-		if (!compression_functions[i]) {
+	analyze_states.reserve(candidates.size());
+	for (idx_t i = 0; i < candidates.size(); i++) {
+		if (!candidates[i]) {
 			analyze_states.push_back(nullptr);
 			continue;
 		}
-		analyze_states.push_back(compression_functions[i]->init_analyze(col_data, col_data.type.InternalType()));
+		analyze_states.push_back(candidates[i]->init_analyze(col_data, col_data.type.InternalType()));
 	}
 
 	// scan over all the segments and run the analyze step
-	ScanSegments([&](Vector &scan_vector, idx_t count) {
-		for (idx_t i = 0; i < compression_functions.size(); i++) {
-			if (!compression_functions[i]) {
-				continue;
-			}
-			bool success = false;
-			if (analyze_states[i]) {
-				success = compression_functions[i]->analyze(*analyze_states[i], scan_vector, count);
-			}
-			if (!success) {
-				// could not use this compression function on this data set
-				// erase it
-				compression_functions[i] = nullptr;
-				analyze_states[i].reset();
-			}
-		}
-	});
+	ScanSegments(
+	    [&](Vector &scan_vector, idx_t count) {
+		    for (idx_t i = 0; i < candidates.size(); i++) {
+			    if (!candidates[i]) {
+				    continue;
+			    }
+			    bool success = false;
+			    if (analyze_states[i]) {
+				    success = candidates[i]->analyze(*analyze_states[i], scan_vector, count);
+			    }
+			    if (!success) {
+				    // could not use this compression function on this data set
+				    // erase it
+				    candidates[i] = nullptr;
+				    analyze_states[i].reset();
+			    }
+		    }
+	    },
+	    sample_interval);
 
 	// now that we have passed over all the data, we need to figure out the best method
 	// we do this using the final_analyze method
 	unique_ptr<AnalyzeState> state;
 	compression_idx = DConstants::INVALID_INDEX;
-	idx_t best_score = NumericLimits<idx_t>::Maximum();
-	for (idx_t i = 0; i < compression_functions.size(); i++) {
-		if (!compression_functions[i]) {
+	best_score = NumericLimits<idx_t>::Maximum();
+	for (idx_t i = 0; i < candidates.size(); i++) {
+		if (!candidates[i]) {
 			continue;
 		}
 		if (!analyze_states[i]) {
 			continue;
 		}
 		//! Check if the method type is the forced method (if forced is used)
-		bool forced_method_found = compression_functions[i]->type == forced_method;
-		auto score = compression_functions[i]->final_analyze(*analyze_states[i]);
+		bool forced_method_found = candidates[i]->type == forced_method;
+		auto score = candidates[i]->final_analyze(*analyze_states[i]);
 
 		//! The finalize method can return this value from final_analyze to indicate it should not be used.
 		if (score == DConstants::INVALID_INDEX) {
@@ -172,6 +204,115 @@ unique_ptr<AnalyzeState> ColumnDataCheckpointer::DetectBestCompressionMethod(idx
 	return state;
 }
 
+unique_ptr<AnalyzeState> ColumnDataCheckpointer::AnalyzeCompressionMethod(idx_t compression_idx, idx_t &score) {
+	vector<optional_ptr<CompressionFunction>> candidates(compression_functions.size());
+	candidates[compression_idx] = compression_functions[compression_idx];
+	idx_t result_idx;
+	auto state = AnalyzeCompressionMethods(candidates, CompressionType::COMPRESSION_AUTO, 1, result_idx, score);
+	if (!candidates[compression_idx]) {
+		// the compression method cannot compress this data
+		compression_functions[compression_idx] = nullptr;
+	}
+	return state;
+}
+
+unique_ptr<AnalyzeState> ColumnDataCheckpointer::AnalyzeCachedCompressionMethod(const CachedCompressionMethod &cached,
+                                                                                idx_t &compression_idx) {
+	if (cached.reuse_count >= CACHED_COMPRESSION_MAX_REUSE) {
+		// periodically re-evaluate all compression methods, the data might have changed
+		return nullptr;
+	}
+	if (cached.physical_type != GetType().InternalType()) {
+		return nullptr;
+	}
+	for (idx_t i = 0; i < compression_functions.size(); i++) {
+		if (!compression_functions[i] || compression_functions[i]->type != cached.type) {
+			continue;
+		}
+		idx_t score;
+		auto state = AnalyzeCompressionMethod(i, score);
+		if (!state) {
+			return nullptr;
+		}
+		// the cached compression method is only reused if it compresses about as well as it did before
+		// if it compresses a lot better or worse, the data has changed and another method might be better
+		auto score_per_row = static_cast<double>(score) / static_cast<double>(GetRowCount());
+		if (score_per_row > cached.score_per_row * CACHED_COMPRESSION_TOLERANCE ||
+		    score_per_row * CACHED_COMPRESSION_TOLERANCE < cached.score_per_row) {
+			return nullptr;
+		}
+		compression_idx = i;
+		return state;
+	}
+	return nullptr;
+}
+
+unique_ptr<AnalyzeState> ColumnDataCheckpointer::DetectBestCompressionMethod(idx_t &compression_idx) {
+	D_ASSERT(!compression_functions.empty());
+	auto &config = DBConfig::GetConfig(GetDatabase());
+	CompressionType forced_method = CompressionType::COMPRESSION_AUTO;
+
+	auto compression_type = checkpoint_info.GetCompressionType();
+	if (compression_type != CompressionType::COMPRESSION_AUTO) {
+		forced_method = ForceCompression(compression_functions, compression_type);
+	}
+	if (compression_type == CompressionType::COMPRESSION_AUTO &&
+	    config.options.force_compression != CompressionType::COMPRESSION_AUTO) {
+		forced_method = ForceCompression(compression_functions, config.options.force_compression);
+	}
+	idx_t score;
+	if (forced_method != CompressionType::COMPRESSION_AUTO) {
+		// the forced method is used whenever it can compress the data, there is nothing to sample or cache
+		return AnalyzeCompressionMethods(compression_functions, forced_method, 1, compression_idx, score);
+	}
+	// compression methods that the storage compatibility version cannot read are only used if they are forced
+	for (auto &function : compression_functions) {
+		if (function &&
+		    !config.options.serialization_compatibility.Compare(CompressionSerializationVersion(function->type))) {
+			function = nullptr;
+		}
+	}
+
+	// first try the compression method that was chosen for this column at the previous checkpoint
+	auto &table_info = col_data.GetTableInfo();
+	auto column_path = GetColumnPath();
+	CachedCompressionMethod cached;
+	if (table_info.GetCachedCompression(column_path, cached)) {
+		auto state = AnalyzeCachedCompressionMethod(cached, compression_idx);
+		if (state) {
+			cached.reuse_count++;
+			table_info.SetCachedCompression(column_path, cached);
+			return state;
+		}
+	}
+
+	unique_ptr<AnalyzeState> state;
+	auto vector_count = (GetRowCount() + STANDARD_VECTOR_SIZE - 1) / STANDARD_VECTOR_SIZE;
+	if (vector_count > ANALYSIS_SAMPLE_THRESHOLD) {
+		// analyze a sample of the vectors with all compression methods to choose a method
+		auto sample_state = AnalyzeCompressionMethods(compression_functions, CompressionType::COMPRESSION_AUTO,
+		                                              ANALYSIS_SAMPLE_INTERVAL, compression_idx, score);
+		if (sample_state) {
+			sample_state.reset();
+			// analyze all vectors with the chosen method only: this also verifies that it can compress all the data
+			state = AnalyzeCompressionMethod(compression_idx, score);
+		}
+	}
+	if (!state) {
+		// analyze all vectors with all compression methods
+		state = AnalyzeCompressionMethods(compression_functions, CompressionType::COMPRESSION_AUTO, 1,
+		                                  compression_idx, score);
+	}
+	if (state) {
+		cached.type = compression_functions[compression_idx]->type;
+		cached.physical_type = GetType().InternalType();
+		cached.score_per_row = static_cast<double>(score) / static_cast<double>(GetRowCount());
+		cached.reuse_count = 0;
+		table_info.SetCachedCompression(column_path, cached);
+	}
+	return state;
+}
+
 void ColumnDataCheckpointer::WriteToDisk() {
 	// there were changes or transient segments
 	// we need to rewrite the column segments to disk
@@ -7,6 +7,7 @@
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/main/config.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
@@ -501,6 +502,18 @@ idx_t ColumnSegment::FilterSelection(SelectionVector &sel, Vector &vector, Unifi
 		return FilterSelection(sel, *child_vec, child_data, *struct_filter.child_filter, scan_count,
 		                       approved_tuple_count);
 	}
+	case TableFilterType::DYNAMIC_FILTER: {
+		auto &dynamic_filter = filter.Cast<DynamicFilter>();
+		if (!dynamic_filter.filter_data) {
+			return approved_tuple_count;
+		}
+		auto constant_filter = dynamic_filter.filter_data->GetFilter();
+		if (!constant_filter) {
+			// the filter has not been set yet: all tuples pass
+			return approved_tuple_count;
+		}
+		return FilterSelection(sel, vector, vdata, *constant_filter, scan_count, approved_tuple_count);
+	}
 	default:
 		throw InternalException("FIXME: unsupported type for filter selection");
 	}
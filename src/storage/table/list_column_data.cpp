@@ -24,6 +24,10 @@ void ListColumnData::SetStart(idx_t new_start) {
 	validity.SetStart(new_start);
 }
 
+bool ListColumnData::HasChanges() {
+	return ColumnData::HasChanges() || validity.HasChanges() || child_column->HasChanges();
+}
+
 bool ListColumnData::CheckZonemap(ColumnScanState &state, TableFilter &filter) {
 	// table filters are not supported yet for list columns
 	return false;
@@ -37,6 +37,7 @@ RowGroup::RowGroup(RowGroupCollection &collection_p, RowGroupPointer pointer)
 		throw IOException("Row group column count is unaligned with table column count. Corrupt file?");
 	}
 	this->column_pointers = std::move(pointer.data_pointers);
+	this->column_metadata_blocks = std::move(pointer.metadata_blocks);
 	this->columns.resize(column_pointers.size());
 	this->is_loaded = unique_ptr<atomic<bool>[]>(new atomic<bool>[columns.size()]);
 	for (idx_t c = 0; c < columns.size(); c++) {
@@ -50,6 +51,13 @@ RowGroup::RowGroup(RowGroupCollection &collection_p, RowGroupPointer pointer)
 
 void RowGroup::MoveToCollection(RowGroupCollection &collection_p, idx_t new_start) {
 	this->collection = collection_p;
+	if (new_start != start && !column_pointers.empty()) {
+		// the column metadata on disk refers to the old row start - it can no longer be re-used
+		// load all columns first, as the pointers can no longer be used to lazily load them afterwards
+		GetColumns();
+		column_pointers.clear();
+		column_metadata_blocks.clear();
+	}
 	this->start = new_start;
 	for (auto &column : GetColumns()) {
 		column->SetStart(new_start);
@@ -397,6 +405,7 @@ static idx_t GetFilterScanCount(ColumnScanState &state, TableFilter &filter) {
 	case TableFilterType::IS_NULL:
 	case TableFilterType::IS_NOT_NULL:
 	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::DYNAMIC_FILTER:
 		return state.current->start + state.current->count;
 	default: {
 		throw NotImplementedException("Unimplemented filter type for zonemap");
@@ -863,9 +872,43 @@ RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriter &writer) {
 	return WriteToDisk(info);
 }
 
+bool RowGroup::HasChanges() {
+	if (column_pointers.size() != GetColumnCount() || column_metadata_blocks.empty()) {
+		// the row group has not been written to disk (at its current position) yet
+		// or we do not know which metadata blocks it occupies (e.g., when it was written by an older version)
+		return true;
+	}
+	for (idx_t column_idx = 0; column_idx < GetColumnCount(); column_idx++) {
+		if (is_loaded && !is_loaded[column_idx]) {
+			// the column has not been loaded - so it cannot have been changed either
+			continue;
+		}
+		auto &column = *columns[column_idx];
+		if (column.count != this->count || column.HasChanges()) {
+			return true;
+		}
+	}
+	return false;
+}
+
 RowGroupPointer RowGroup::Checkpoint(RowGroupWriteData write_data, RowGroupWriter &writer,
                                      TableStatistics &global_stats) {
 	RowGroupPointer row_group_pointer;
+	row_group_pointer.row_start = start;
+	row_group_pointer.tuple_count = count;
+	if (write_data.reuse_existing_metadata) {
+		// the columns are unchanged since the last checkpoint - point to the existing column metadata
+		// the statistics of the columns are already part of the global stats, so there is nothing to merge either
+		D_ASSERT(!HasChanges());
+		auto &manager = writer.GetPayloadWriter().GetManager();
+		// ensure the blocks we are pointing to are not marked as free
+		manager.ClearModifiedBlocks(column_metadata_blocks);
+		row_group_pointer.data_pointers = column_pointers;
+		row_group_pointer.metadata_blocks = column_metadata_blocks;
+		row_group_pointer.deletes_pointers = CheckpointDeletes(manager);
+		Verify();
+		return row_group_pointer;
+	}
 
 	auto lock = global_stats.GetLock();
 	for (idx_t column_idx = 0; column_idx < GetColumnCount(); column_idx++) {
@@ -874,8 +917,7 @@ RowGroupPointer RowGroup::Checkpoint(RowGroupWriteData write_data, RowGroupWrite
 
 	// construct the row group pointer and write the column meta data to disk
 	D_ASSERT(write_data.states.size() == columns.size());
-	row_group_pointer.row_start = start;
-	row_group_pointer.tuple_count = count;
+	auto &metadata_blocks = row_group_pointer.metadata_blocks;
 	for (auto &state : write_data.states) {
 		// get the current position of the table data writer
 		auto &data_writer = writer.GetPayloadWriter();
@@ -884,6 +926,12 @@ RowGroupPointer RowGroup::Checkpoint(RowGroupWriteData write_data, RowGroupWrite
 		// store the stats and the data pointers in the row group pointers
 		row_group_pointer.data_pointers.push_back(pointer);
 
+		// keep track of the metadata blocks we write to, so the metadata can be re-used by the next checkpoint
+		if (metadata_blocks.empty() || metadata_blocks.back().block_pointer != pointer.block_pointer) {
+			metadata_blocks.push_back(pointer);
+		}
+		data_writer.SetWrittenPointers(&metadata_blocks);
+
 		// Write pointers to the column segments.
 		//
 		// Just as above, the state can refer to many other states, so this
@@ -892,7 +940,10 @@ RowGroupPointer RowGroup::Checkpoint(RowGroupWriteData write_data, RowGroupWrite
 		serializer.Begin();
 		state->WriteDataPointers(writer, serializer);
 		serializer.End();
+		data_writer.SetWrittenPointers(nullptr);
 	}
+	column_pointers = row_group_pointer.data_pointers;
+	column_metadata_blocks = metadata_blocks;
 	row_group_pointer.deletes_pointers = CheckpointDeletes(writer.GetPayloadWriter().GetManager());
 	Verify();
 	return row_group_pointer;
@@ -917,6 +968,9 @@ void RowGroup::Serialize(RowGroupPointer &pointer, Serializer &serializer) {
 	serializer.WriteProperty(101, "tuple_count", pointer.tuple_count);
 	serializer.WriteProperty(102, "data_pointers", pointer.data_pointers);
 	serializer.WriteProperty(103, "delete_pointers", pointer.deletes_pointers);
+	if (serializer.ShouldSerialize(2)) {
+		serializer.WritePropertyWithDefault(104, "metadata_blocks", pointer.metadata_blocks);
+	}
 }
 
 RowGroupPointer RowGroup::Deserialize(Deserializer &deserializer) {
@@ -925,6 +979,7 @@ RowGroupPointer RowGroup::Deserialize(Deserializer &deserializer) {
 	result.tuple_count = deserializer.ReadProperty<uint64_t>(101, "tuple_count");
 	result.data_pointers = deserializer.ReadProperty<vector<MetaBlockPointer>>(102, "data_pointers");
 	result.deletes_pointers = deserializer.ReadProperty<vector<MetaBlockPointer>>(103, "delete_pointers");
+	result.metadata_blocks = deserializer.ReadPropertyWithDefault<vector<MetaBlockPointer>>(104, "metadata_blocks");
 	return result;
 }
 
@@ -5,6 +5,7 @@
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/planner/constraints/bound_not_null_constraint.hpp"
 #include "duckdb/storage/checkpoint/table_data_writer.hpp"
+#include "duckdb/storage/checkpoint/table_data_reader.hpp"
 #include "duckdb/storage/table/row_group_segment_tree.hpp"
 #include "duckdb/storage/metadata/metadata_reader.hpp"
 #include "duckdb/storage/table/append_state.hpp"
@@ -35,7 +36,15 @@ void RowGroupSegmentTree::Initialize(PersistentTableData &data) {
 	reader = make_uniq<MetadataReader>(collection.GetMetadataManager(), data.block_pointer);
 }
 
+void RowGroupSegmentTree::InitializeLazy() {
+	current_row_group = 0;
+	max_row_group = 0;
+	finished_loading = false;
+}
+
 unique_ptr<RowGroup> RowGroupSegmentTree::LoadSegment() {
+	// make sure the row group pointers have been read
+	collection.LoadTableData();
 	if (current_row_group >= max_row_group) {
 		reader.reset();
 		finished_loading = true;
@@ -55,7 +64,7 @@ unique_ptr<RowGroup> RowGroupSegmentTree::LoadSegment() {
 RowGroupCollection::RowGroupCollection(shared_ptr<DataTableInfo> info_p, BlockManager &block_manager,
                                        vector<LogicalType> types_p, idx_t row_start_p, idx_t total_rows_p)
     : block_manager(block_manager), total_rows(total_rows_p), info(std::move(info_p)), types(std::move(types_p)),
-      row_start(row_start_p), allocation_size(0) {
+      row_start(row_start_p), allocation_size(0), table_data_loaded(true) {
 	row_groups = make_shared_ptr<RowGroupSegmentTree>(*this);
 }
 
@@ -86,10 +95,38 @@ void RowGroupCollection::Initialize(PersistentTableData &data) {
 	D_ASSERT(this->row_start == 0);
 	auto l = row_groups->Lock();
 	this->total_rows = data.total_rows;
+	if (data.table_pointer.IsValid()) {
+		// defer reading the statistics and row group pointers until they are first needed
+		table_pointer = data.table_pointer;
+		table_data_loaded = false;
+		row_groups->InitializeLazy();
+		return;
+	}
 	row_groups->Initialize(data);
 	stats.Initialize(types, data);
 }
 
+void RowGroupCollection::LoadTableData() {
+	if (table_data_loaded) {
+		return;
+	}
+	lock_guard<mutex> guard(load_lock);
+	if (table_data_loaded) {
+		return;
+	}
+	PersistentTableData data(types.size());
+	MetadataReader reader(GetMetadataManager(), table_pointer);
+	TableDataReader data_reader(reader, types, data);
+	data_reader.ReadTableData();
+	data.total_rows = total_rows;
+
+	if (data.row_group_count > 0) {
+		row_groups->Initialize(data);
+	}
+	stats.Initialize(types, data);
+	table_data_loaded = true;
+}
+
 void RowGroupCollection::InitializeEmpty() {
 	stats.InitializeEmpty(types);
 }
@@ -107,6 +144,10 @@ RowGroup *RowGroupCollection::GetRowGroup(int64_t index) {
 
 void RowGroupCollection::Verify() {
 #ifdef DEBUG
+	if (!table_data_loaded) {
+		// verifying would load the table data
+		return;
+	}
 	idx_t current_total_rows = 0;
 	row_groups->Verify();
 	for (auto &row_group : row_groups->Segments()) {
@@ -171,11 +212,38 @@ void RowGroupCollection::InitializeParallelScan(ParallelCollectionScanState &sta
 	state.processed_rows = 0;
 }
 
+//! Adapts the morsel size of a parallel scan to the time this thread spent on its previous morsel
+static void UpdateMorselSize(ParallelCollectionScanState &state, CollectionScanState &scan_state) {
+	if (scan_state.morsel_vector_count == 0) {
+		// this thread has not scanned a morsel yet
+		return;
+	}
+	auto elapsed = MaxValue<double>(scan_state.morsel_timer.Elapsed(), 1e-6);
+	auto seconds_per_vector = elapsed / static_cast<double>(scan_state.morsel_vector_count);
+	auto target_vector_count = ParallelCollectionScanState::TARGET_MORSEL_SECONDS / seconds_per_vector;
+	target_vector_count =
+	    MinValue<double>(target_vector_count, ParallelCollectionScanState::MAXIMUM_MORSEL_VECTOR_COUNT);
+	target_vector_count =
+	    MaxValue<double>(target_vector_count, ParallelCollectionScanState::MINIMUM_MORSEL_VECTOR_COUNT);
+	// move halfway towards the target, so a single slow or fast morsel does not dominate
+	state.morsel_vector_count = (state.morsel_vector_count + static_cast<idx_t>(target_vector_count)) / 2;
+	state.morsel_vector_count =
+	    MaxValue<idx_t>(state.morsel_vector_count, ParallelCollectionScanState::MINIMUM_MORSEL_VECTOR_COUNT);
+	scan_state.morsel_vector_count = 0;
+}
+
+static idx_t GetVectorCount(idx_t row_count) {
+	return (row_count + STANDARD_VECTOR_SIZE - 1) / STANDARD_VECTOR_SIZE;
+}
+
 bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollectionScanState &state,
                                           CollectionScanState &scan_state) {
+	auto verify_parallelism = ClientConfig::GetConfig(context).verify_parallelism;
+	auto thread_count = NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
 	while (true) {
 		idx_t vector_index;
 		idx_t max_row;
+		idx_t morsel_vector_count;
 		RowGroupCollection *collection;
 		RowGroup *row_group;
 		{
@@ -187,35 +255,81 @@ bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollec
 			}
 			collection = state.collection;
 			row_group = state.current_row_group;
-			if (ClientConfig::GetConfig(context).verify_parallelism) {
-				vector_index = state.vector_index;
+			vector_index = state.vector_index;
+			if (verify_parallelism) {
 				max_row = state.current_row_group->start +
 				          MinValue<idx_t>(state.current_row_group->count,
 				                          STANDARD_VECTOR_SIZE * state.vector_index + STANDARD_VECTOR_SIZE);
 				D_ASSERT(vector_index * STANDARD_VECTOR_SIZE < state.current_row_group->count);
+				morsel_vector_count = 1;
 				state.vector_index++;
 				if (state.vector_index * STANDARD_VECTOR_SIZE >= state.current_row_group->count) {
 					state.current_row_group = row_groups->GetNextSegment(state.current_row_group);
 					state.vector_index = 0;
 				}
+				max_row = MinValue<idx_t>(max_row, state.max_row);
 			} else {
-				state.processed_rows += state.current_row_group->count;
-				vector_index = 0;
-				max_row = state.current_row_group->start + state.current_row_group->count;
-				state.current_row_group = row_groups->GetNextSegment(state.current_row_group);
+				UpdateMorselSize(state, scan_state);
+				// near the end of the scan we hand out smaller morsels, so the threads finish at the same time
+				auto morsel_start = row_group->start + vector_index * STANDARD_VECTOR_SIZE;
+				auto remaining_vectors = GetVectorCount(state.max_row - MinValue(state.max_row, morsel_start));
+				morsel_vector_count = MinValue(state.morsel_vector_count, remaining_vectors / thread_count);
+				morsel_vector_count =
+				    MaxValue(morsel_vector_count, ParallelCollectionScanState::MINIMUM_MORSEL_VECTOR_COUNT);
+
+				// the morsel can start and end within a row group, or span multiple row groups
+				auto current_row_group = row_group;
+				auto current_vector_index = vector_index;
+				idx_t assigned_vectors = 0;
+				while (true) {
+					auto row_group_vectors = GetVectorCount(current_row_group->count) - current_vector_index;
+					if (morsel_vector_count - assigned_vectors < row_group_vectors) {
+						// the morsel ends within this row group
+						current_vector_index += morsel_vector_count - assigned_vectors;
+						max_row = current_row_group->start + current_vector_index * STANDARD_VECTOR_SIZE;
+						state.current_row_group = current_row_group;
+						state.vector_index = current_vector_index;
+						break;
+					}
+					// the morsel includes the rest of this row group
+					assigned_vectors += row_group_vectors;
+					max_row = current_row_group->start + current_row_group->count;
+					current_row_group = row_groups->GetNextSegment(current_row_group);
+					if (assigned_vectors == morsel_vector_count || !current_row_group ||
+					    current_row_group->count == 0 || current_row_group->start >= state.max_row) {
+						state.current_row_group = current_row_group;
+						state.vector_index = 0;
+						break;
+					}
+					current_vector_index = 0;
+				}
+				max_row = MinValue<idx_t>(max_row, state.max_row);
+				state.processed_rows += max_row - MinValue<idx_t>(max_row, morsel_start);
 			}
-			max_row = MinValue<idx_t>(max_row, state.max_row);
 			scan_state.batch_index = ++state.batch_index;
 		}
 		D_ASSERT(collection);
 		D_ASSERT(row_group);
 
-		// initialize the scan for this row group
-		bool need_to_scan = InitializeScanInRowGroup(scan_state, *collection, *row_group, vector_index, max_row);
+		// initialize the scan for this morsel, skipping the row groups that do not need to be scanned
+		bool need_to_scan;
+		while (true) {
+			need_to_scan = InitializeScanInRowGroup(scan_state, *collection, *row_group, vector_index, max_row);
+			if (need_to_scan) {
+				break;
+			}
+			row_group = row_groups->GetNextSegment(row_group);
+			vector_index = 0;
+			if (!row_group || row_group->start >= max_row) {
+				break;
+			}
+		}
 		if (!need_to_scan) {
-			// skip this row group
+			// skip this morsel
 			continue;
 		}
+		scan_state.morsel_vector_count = morsel_vector_count;
+		scan_state.morsel_timer.Start();
 		return true;
 	}
 	lock_guard<mutex> l(state.lock);
@@ -445,6 +559,7 @@ void RowGroupCollection::RevertAppendInternal(idx_t start_row) {
 
 void RowGroupCollection::MergeStorage(RowGroupCollection &data) {
 	D_ASSERT(data.types == types);
+	LoadTableData();
 	auto index = row_start + total_rows.load();
 	auto segments = data.row_groups->MoveSegments();
 	for (auto &entry : segments) {
@@ -968,10 +1083,16 @@ void RowGroupCollection::Checkpoint(TableDataWriter &writer, TableStatistics &gl
 			// row group was vacuumed/dropped - skip
 			continue;
 		}
-		// schedule a checkpoint task for this row group
 		entry.node->MoveToCollection(*this, vacuum_state.row_start);
-		ScheduleCheckpointTask(checkpoint_state, segment_idx);
 		vacuum_state.row_start += entry.node->count;
+		if (!entry.node->HasChanges()) {
+			// the row group is unchanged since it was last written - re-use its metadata instead of rewriting it
+			checkpoint_state.writers[segment_idx] = writer.GetRowGroupWriter(*entry.node);
+			checkpoint_state.write_data[segment_idx].reuse_existing_metadata = true;
+			continue;
+		}
+		// schedule a checkpoint task for this row group
+		ScheduleCheckpointTask(checkpoint_state, segment_idx);
 	}
 	// all tasks have been scheduled - execute tasks until we are done
 	do {
@@ -1044,6 +1165,7 @@ shared_ptr<RowGroupCollection> RowGroupCollection::AddColumn(ClientContext &cont
 	idx_t new_column_idx = types.size();
 	auto new_types = types;
 	new_types.push_back(new_column.GetType());
+	LoadTableData();
 	auto result =
 	    make_shared_ptr<RowGroupCollection>(info, block_manager, std::move(new_types), row_start, total_rows.load());
 
@@ -1071,6 +1193,7 @@ shared_ptr<RowGroupCollection> RowGroupCollection::RemoveColumn(idx_t col_idx) {
 	auto new_types = types;
 	new_types.erase_at(col_idx);
 
+	LoadTableData();
 	auto result =
 	    make_shared_ptr<RowGroupCollection>(info, block_manager, std::move(new_types), row_start, total_rows.load());
 	result->stats.InitializeRemoveColumn(stats, col_idx);
@@ -1089,6 +1212,7 @@ shared_ptr<RowGroupCollection> RowGroupCollection::AlterType(ClientContext &cont
 	auto new_types = types;
 	new_types[changed_idx] = target_type;
 
+	LoadTableData();
 	auto result =
 	    make_shared_ptr<RowGroupCollection>(info, block_manager, std::move(new_types), row_start, total_rows.load());
 	result->stats.InitializeAlterType(stats, changed_idx, target_type);
@@ -1163,15 +1287,18 @@ void RowGroupCollection::VerifyNewConstraint(DataTable &parent, const BoundConst
 // Statistics
 //===--------------------------------------------------------------------===//
 void RowGroupCollection::CopyStats(TableStatistics &other_stats) {
+	LoadTableData();
 	stats.CopyStats(other_stats);
 }
 
 unique_ptr<BaseStatistics> RowGroupCollection::CopyStats(column_t column_id) {
+	LoadTableData();
 	return stats.CopyStats(column_id);
 }
 
 void RowGroupCollection::SetDistinct(column_t column_id, unique_ptr<DistinctStatistics> distinct_stats) {
 	D_ASSERT(column_id != COLUMN_IDENTIFIER_ROW_ID);
+	LoadTableData();
 	auto stats_lock = stats.GetLock();
 	stats.GetStats(*stats_lock, column_id).SetDistinct(std::move(distinct_stats));
 }
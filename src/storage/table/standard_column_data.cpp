@@ -21,6 +21,10 @@ void StandardColumnData::SetStart(idx_t new_start) {
 	validity.SetStart(new_start);
 }
 
+bool StandardColumnData::HasChanges() {
+	return ColumnData::HasChanges() || validity.HasChanges();
+}
+
 ScanVectorType StandardColumnData::GetVectorScanType(ColumnScanState &state, idx_t scan_count) {
 	// if either the current column data, or the validity column data requires flat vectors, we scan flat vectors
 	auto scan_type = ColumnData::GetVectorScanType(state, scan_count);
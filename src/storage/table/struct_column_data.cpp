@@ -36,6 +36,18 @@ void StructColumnData::SetStart(idx_t new_start) {
 	validity.SetStart(new_start);
 }
 
+bool StructColumnData::HasChanges() {
+	if (validity.HasChanges()) {
+		return true;
+	}
+	for (auto &sub_column : sub_columns) {
+		if (sub_column->HasChanges()) {
+			return true;
+		}
+	}
+	return false;
+}
+
 bool StructColumnData::CheckZonemap(ColumnScanState &state, TableFilter &filter) {
 	if (!state.segment_checked) {
 		if (!state.current) {
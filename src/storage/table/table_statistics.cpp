@@ -127,15 +127,12 @@ void TableStatistics::Serialize(Serializer &serializer) const {
 	serializer.WritePropertyWithDefault<unique_ptr<BlockingSample>>(101, "table_sample", table_sample, nullptr);
 }
 
-void TableStatistics::Deserialize(Deserializer &deserializer, ColumnList &columns) {
-	auto physical_columns = columns.Physical();
-
-	auto iter = physical_columns.begin();
+void TableStatistics::Deserialize(Deserializer &deserializer, const vector<LogicalType> &types) {
 	deserializer.ReadList(100, "column_stats", [&](Deserializer::List &list, idx_t i) {
-		auto &col = *iter;
-		iter.operator++();
-
-		auto type = col.GetType();
+		if (i >= types.size()) { // LCOV_EXCL_START
+			throw IOException("Table statistics column count is not aligned with table column count. Corrupt file?");
+		} // LCOV_EXCL_STOP
+		auto type = types[i];
 		deserializer.Set<LogicalType &>(type);
 
 		column_stats.push_back(list.ReadElement<shared_ptr<ColumnStatistics>>());
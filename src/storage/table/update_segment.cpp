@@ -81,6 +81,12 @@ void UpdateInfo::Verify() {
 #endif
 }
 
+//! Returns the position of the first tuple in the (sorted) update info that is >= row_idx
+static idx_t FindTuple(UpdateInfo *current, idx_t row_idx) {
+	auto entry = std::lower_bound(current->tuples, current->tuples + current->N, row_idx);
+	return NumericCast<idx_t>(entry - current->tuples);
+}
+
 //===--------------------------------------------------------------------===//
 // Update Fetch
 //===--------------------------------------------------------------------===//
@@ -246,11 +252,9 @@ void UpdateSegment::FetchCommitted(idx_t vector_index, Vector &result) {
 static void MergeUpdateInfoRangeValidity(UpdateInfo *current, idx_t start, idx_t end, idx_t result_offset,
                                          ValidityMask &result_mask) {
 	auto info_data = reinterpret_cast<bool *>(current->tuple_data);
-	for (idx_t i = 0; i < current->N; i++) {
+	for (idx_t i = FindTuple(current, start); i < current->N; i++) {
 		auto tuple_idx = current->tuples[i];
-		if (tuple_idx < start) {
-			continue;
-		} else if (tuple_idx >= end) {
+		if (tuple_idx >= end) {
 			break;
 		}
 		auto result_idx = result_offset + tuple_idx - start;
@@ -266,11 +270,14 @@ static void FetchCommittedRangeValidity(UpdateInfo *info, idx_t start, idx_t end
 template <class T>
 static void MergeUpdateInfoRange(UpdateInfo *current, idx_t start, idx_t end, idx_t result_offset, T *result_data) {
 	auto info_data = reinterpret_cast<T *>(current->tuple_data);
-	for (idx_t i = 0; i < current->N; i++) {
+	if (start == 0 && end == STANDARD_VECTOR_SIZE && current->N == STANDARD_VECTOR_SIZE) {
+		// the update touches all tuples of this vector: copy the data directly
+		memcpy(result_data + result_offset, info_data, sizeof(T) * current->N);
+		return;
+	}
+	for (idx_t i = FindTuple(current, start); i < current->N; i++) {
 		auto tuple_idx = current->tuples[i];
-		if (tuple_idx < start) {
-			continue;
-		} else if (tuple_idx >= end) {
+		if (tuple_idx >= end) {
 			break;
 		}
 		auto result_idx = result_offset + tuple_idx - start;
@@ -359,14 +366,9 @@ static void FetchRowValidity(transaction_t start_time, transaction_t transaction
 	auto &result_mask = FlatVector::Validity(result);
 	UpdateInfo::UpdatesForTransaction(info, start_time, transaction_id, [&](UpdateInfo *current) {
 		auto info_data = reinterpret_cast<bool *>(current->tuple_data);
-		// FIXME: we could do a binary search in here
-		for (idx_t i = 0; i < current->N; i++) {
-			if (current->tuples[i] == row_idx) {
-				result_mask.Set(result_idx, info_data[i]);
-				break;
-			} else if (current->tuples[i] > row_idx) {
-				break;
-			}
+		auto i = FindTuple(current, row_idx);
+		if (i < current->N && current->tuples[i] == row_idx) {
+			result_mask.Set(result_idx, info_data[i]);
 		}
 	});
 }
@@ -377,14 +379,9 @@ static void TemplatedFetchRow(transaction_t start_time, transaction_t transactio
 	auto result_data = FlatVector::GetData<T>(result);
 	UpdateInfo::UpdatesForTransaction(info, start_time, transaction_id, [&](UpdateInfo *current) {
 		auto info_data = (T *)current->tuple_data;
-		// FIXME: we could do a binary search in here
-		for (idx_t i = 0; i < current->N; i++) {
-			if (current->tuples[i] == row_idx) {
-				result_data[result_idx] = info_data[i];
-				break;
-			} else if (current->tuples[i] > row_idx) {
-				break;
-			}
+		auto i = FindTuple(current, row_idx);
+		if (i < current->N && current->tuples[i] == row_idx) {
+			result_data[result_idx] = info_data[i];
 		}
 	});
 }
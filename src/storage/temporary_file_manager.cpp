@@ -1,6 +1,9 @@
 #include "duckdb/storage/temporary_file_manager.hpp"
 #include "duckdb/storage/buffer/temporary_file_information.hpp"
 #include "duckdb/storage/standard_buffer_manager.hpp"
+#include "duckdb/main/config.hpp"
+
+#include "lz4.hpp"
 
 namespace duckdb {
 
@@ -8,10 +11,11 @@ namespace duckdb {
 // BlockIndexManager
 //===--------------------------------------------------------------------===//
 
-BlockIndexManager::BlockIndexManager(TemporaryFileManager &manager) : max_index(0), manager(&manager) {
+BlockIndexManager::BlockIndexManager(TemporaryFileManager &manager, idx_t block_size)
+    : max_index(0), manager(&manager), block_size(block_size) {
 }
 
-BlockIndexManager::BlockIndexManager() : max_index(0), manager(nullptr) {
+BlockIndexManager::BlockIndexManager() : max_index(0), manager(nullptr), block_size(0) {
 }
 
 idx_t BlockIndexManager::GetNewBlockIndex() {
@@ -53,12 +57,15 @@ idx_t BlockIndexManager::GetMaxIndex() {
 	return max_index;
 }
 
+idx_t BlockIndexManager::GetIndexCount() {
+	return indexes_in_use.size();
+}
+
 bool BlockIndexManager::HasFreeBlocks() {
 	return !free_indexes.empty();
 }
 
 void BlockIndexManager::SetMaxIndex(idx_t new_index) {
-	static constexpr idx_t TEMPFILE_BLOCK_SIZE = Storage::BLOCK_ALLOC_SIZE;
 	if (!manager) {
 		max_index = new_index;
 	} else {
@@ -66,11 +73,11 @@ void BlockIndexManager::SetMaxIndex(idx_t new_index) {
 		if (new_index < old) {
 			max_index = new_index;
 			auto difference = old - new_index;
-			auto size_on_disk = difference * TEMPFILE_BLOCK_SIZE;
+			auto size_on_disk = difference * block_size;
 			manager->DecreaseSizeOnDisk(size_on_disk);
 		} else if (new_index > old) {
 			auto difference = new_index - old;
-			auto size_on_disk = difference * TEMPFILE_BLOCK_SIZE;
+			auto size_on_disk = difference * block_size;
 			manager->IncreaseSizeOnDisk(size_on_disk);
 			// Increase can throw, so this is only updated after it was succesfully updated
 			max_index = new_index;
@@ -94,11 +101,20 @@ idx_t BlockIndexManager::GetNewBlockIndexInternal() {
 // TemporaryFileHandle
 //===--------------------------------------------------------------------===//
 
+static string GetTemporaryFileName(idx_t index, idx_t slot_size) {
+	if (slot_size == Storage::BLOCK_ALLOC_SIZE) {
+		return "duckdb_temp_storage-" + to_string(index) + ".tmp";
+	}
+	// files with compressed blocks include their slot size (in KiB) in the name
+	return "duckdb_temp_storage_" + to_string(slot_size / 1024) + "K-" + to_string(index) + ".tmp";
+}
+
 TemporaryFileHandle::TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory,
-                                         idx_t index, TemporaryFileManager &manager)
+                                         idx_t index, idx_t slot_size, TemporaryFileManager &manager)
     : max_allowed_index((1 << temp_file_count) * MAX_ALLOWED_INDEX_BASE), db(db), file_index(index),
-      path(FileSystem::GetFileSystem(db).JoinPath(temp_directory, "duckdb_temp_storage-" + to_string(index) + ".tmp")),
-      index_manager(manager) {
+      slot_size(slot_size),
+      path(FileSystem::GetFileSystem(db).JoinPath(temp_directory, GetTemporaryFileName(index, slot_size))),
+      index_manager(manager, slot_size) {
 }
 
 TemporaryFileHandle::TemporaryFileLock::TemporaryFileLock(mutex &mutex) : lock(mutex) {
@@ -117,16 +133,46 @@ TemporaryFileIndex TemporaryFileHandle::TryGetBlockIndex() {
 	return TemporaryFileIndex(file_index, block_index);
 }
 
-void TemporaryFileHandle::WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index) {
+void TemporaryFileHandle::WriteTemporaryFile(FileBuffer &buffer, AllocatedData &compressed_buffer,
+                                             TemporaryFileIndex index) {
 	D_ASSERT(buffer.size == Storage::BLOCK_SIZE);
-	buffer.Write(*handle, GetPositionInFile(index.block_index));
+	if (!IsCompressed()) {
+		buffer.Write(*handle, GetPositionInFile(index.block_index));
+		return;
+	}
+	// the compressed buffer starts with the compressed size, we only write the part of the slot that is used
+	auto compressed_size = Load<idx_t>(compressed_buffer.get());
+	D_ASSERT(sizeof(idx_t) + compressed_size <= slot_size);
+	handle->Write(compressed_buffer.get(), sizeof(idx_t) + compressed_size, GetPositionInFile(index.block_index));
 }
 
 unique_ptr<FileBuffer> TemporaryFileHandle::ReadTemporaryBuffer(idx_t block_index,
                                                                 unique_ptr<FileBuffer> reusable_buffer) {
-	return StandardBufferManager::ReadTemporaryBufferInternal(BufferManager::GetBufferManager(db), *handle,
-	                                                          GetPositionInFile(block_index), Storage::BLOCK_SIZE,
-	                                                          std::move(reusable_buffer));
+	auto &buffer_manager = BufferManager::GetBufferManager(db);
+	auto position = GetPositionInFile(block_index);
+	if (!IsCompressed()) {
+		return StandardBufferManager::ReadTemporaryBufferInternal(buffer_manager, *handle, position,
+		                                                          Storage::BLOCK_SIZE, std::move(reusable_buffer));
+	}
+	// read the compressed size, followed by the compressed block
+	idx_t compressed_size;
+	handle->Read(&compressed_size, sizeof(idx_t), position);
+	if (sizeof(idx_t) + compressed_size > slot_size) {
+		throw IOException("Corrupt temporary file \"%s\": compressed block of size %llu does not fit in its slot", path,
+		                  compressed_size);
+	}
+	auto compressed_buffer = Allocator::Get(db).Allocate(compressed_size);
+	handle->Read(compressed_buffer.get(), compressed_size, position + sizeof(idx_t));
+
+	// decompress it into a buffer of the default size
+	auto buffer = buffer_manager.ConstructManagedBuffer(Storage::BLOCK_SIZE, std::move(reusable_buffer));
+	auto decompressed_size = duckdb_lz4::LZ4_decompress_safe(
+	    const_char_ptr_cast(compressed_buffer.get()), char_ptr_cast(buffer->InternalBuffer()),
+	    NumericCast<int>(compressed_size), NumericCast<int>(buffer->AllocSize()));
+	if (decompressed_size < 0 || NumericCast<idx_t>(decompressed_size) != buffer->AllocSize()) {
+		throw IOException("Corrupt temporary file \"%s\": failed to decompress block", path);
+	}
+	return buffer;
 }
 
 void TemporaryFileHandle::EraseBlockIndex(block_id_t block_index) {
@@ -154,9 +200,18 @@ TemporaryFileInformation TemporaryFileHandle::GetTemporaryFile() {
 	TemporaryFileInformation info;
 	info.path = path;
 	info.size = GetPositionInFile(index_manager.GetMaxIndex());
+	info.uncompressed_size = index_manager.GetIndexCount() * Storage::BLOCK_ALLOC_SIZE;
 	return info;
 }
 
+idx_t TemporaryFileHandle::GetSlotSize() const {
+	return slot_size;
+}
+
+bool TemporaryFileHandle::IsCompressed() const {
+	return slot_size != Storage::BLOCK_ALLOC_SIZE;
+}
+
 void TemporaryFileHandle::CreateFileIfNotExists(TemporaryFileLock &) {
 	if (handle) {
 		return;
@@ -180,7 +235,7 @@ void TemporaryFileHandle::RemoveTempBlockIndex(TemporaryFileLock &, idx_t index)
 }
 
 idx_t TemporaryFileHandle::GetPositionInFile(idx_t index) {
-	return index * Storage::BLOCK_ALLOC_SIZE;
+	return index * slot_size;
 }
 
 //===--------------------------------------------------------------------===//
@@ -276,16 +331,46 @@ TemporaryFileManager::~TemporaryFileManager() {
 TemporaryFileManager::TemporaryManagerLock::TemporaryManagerLock(mutex &mutex) : lock(mutex) {
 }
 
+idx_t TemporaryFileManager::CompressBuffer(FileBuffer &buffer, AllocatedData &compressed_buffer) {
+	if (!DBConfig::GetConfig(db).options.temp_file_compression) {
+		return Storage::BLOCK_ALLOC_SIZE;
+	}
+	auto uncompressed_size = NumericCast<int>(buffer.AllocSize());
+	auto compressed_bound = duckdb_lz4::LZ4_compressBound(uncompressed_size);
+	compressed_buffer = Allocator::Get(db).Allocate(sizeof(idx_t) + NumericCast<idx_t>(compressed_bound));
+	auto compressed_size = duckdb_lz4::LZ4_compress_default(const_char_ptr_cast(buffer.InternalBuffer()),
+	                                                        char_ptr_cast(compressed_buffer.get() + sizeof(idx_t)),
+	                                                        uncompressed_size, compressed_bound);
+	if (compressed_size > 0) {
+		auto slot_size = AlignValue<idx_t, TemporaryFileHandle::COMPRESSED_SLOT_GRANULARITY>(
+		    sizeof(idx_t) + NumericCast<idx_t>(compressed_size));
+		if (slot_size < Storage::BLOCK_ALLOC_SIZE) {
+			Store<idx_t>(NumericCast<idx_t>(compressed_size), compressed_buffer.get());
+			return slot_size;
+		}
+	}
+	// the block does not compress well enough to fit in a smaller slot: write it uncompressed
+	compressed_buffer.Reset();
+	return Storage::BLOCK_ALLOC_SIZE;
+}
+
 void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer &buffer) {
 	D_ASSERT(buffer.size == Storage::BLOCK_SIZE);
 	TemporaryFileIndex index;
 	TemporaryFileHandle *handle = nullptr;
 
+	// compress the buffer before grabbing the lock, the compressed size determines the file we write to
+	AllocatedData compressed_buffer;
+	auto slot_size = CompressBuffer(buffer, compressed_buffer);
+
 	{
 		TemporaryManagerLock lock(manager_lock);
-		// first check if we can write to an open existing file
+		// first check if we can write to an open existing file with the same slot size
 		for (auto &entry : files) {
 			auto &temp_file = entry.second;
+			if (temp_file->GetSlotSize() != slot_size) {
+				continue;
+			}
 			index = temp_file->TryGetBlockIndex();
 			if (index.IsValid()) {
 				handle = entry.second.get();
@@ -295,7 +380,8 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 		if (!handle) {
 			// no existing handle to write to; we need to create & open a new file
 			auto new_file_index = index_manager.GetNewBlockIndex();
-			auto new_file = make_uniq<TemporaryFileHandle>(files.size(), db, temp_directory, new_file_index, *this);
+			auto new_file =
+			    make_uniq<TemporaryFileHandle>(files.size(), db, temp_directory, new_file_index, slot_size, *this);
 			handle = new_file.get();
 			files[new_file_index] = std::move(new_file);
 
@@ -306,7 +392,7 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 	}
 	D_ASSERT(handle);
 	D_ASSERT(index.IsValid());
-	handle->WriteTemporaryFile(buffer, index);
+	handle->WriteTemporaryFile(buffer, compressed_buffer, index);
 }
 
 bool TemporaryFileManager::HasTemporaryBuffer(block_id_t block_id) {
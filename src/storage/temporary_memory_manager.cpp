@@ -1,14 +1,15 @@
 #include "duckdb/storage/temporary_memory_manager.hpp"
 
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/parallel/resource_group.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 
 namespace duckdb {
 
 TemporaryMemoryState::TemporaryMemoryState(TemporaryMemoryManager &temporary_memory_manager_p,
-                                           idx_t minimum_reservation_p)
-    : temporary_memory_manager(temporary_memory_manager_p), remaining_size(0),
+                                           ResourceGroup &resource_group_p, idx_t minimum_reservation_p)
+    : temporary_memory_manager(temporary_memory_manager_p), resource_group(resource_group_p), remaining_size(0),
       minimum_reservation(minimum_reservation_p), reservation(0) {
 }
 
@@ -59,11 +60,17 @@ unique_ptr<TemporaryMemoryState> TemporaryMemoryManager::Register(ClientContext
 	auto guard = Lock();
 	UpdateConfiguration(context);
 
+	auto &resource_group = TaskScheduler::GetScheduler(context).GetResourceGroup(context);
 	auto minimum_reservation = MinValue(num_threads * MINIMUM_RESERVATION_PER_STATE_PER_THREAD,
 	                                    memory_limit / MINIMUM_RESERVATION_MEMORY_LIMIT_DIVISOR);
-	auto result = unique_ptr<TemporaryMemoryState>(new TemporaryMemoryState(*this, minimum_reservation));
+	if (resource_group.HasMemoryLimit()) {
+		minimum_reservation =
+		    MinValue(minimum_reservation, resource_group.memory_limit / MINIMUM_RESERVATION_MEMORY_LIMIT_DIVISOR);
+	}
+	auto result =
+	    unique_ptr<TemporaryMemoryState>(new TemporaryMemoryState(*this, resource_group, minimum_reservation));
 	SetRemainingSize(*result, result->minimum_reservation);
-	SetReservation(*result, result->minimum_reservation);
+	SetReservation(*result, GetMinimumReservation(*result));
 	active_states.insert(*result);
 
 	Verify();
@@ -75,16 +82,30 @@ void TemporaryMemoryManager::UpdateState(ClientContext &context, TemporaryMemory
 
 	if (context.config.force_external) {
 		// We're forcing external processing. Give it the minimum
-		SetReservation(temporary_memory_state, temporary_memory_state.minimum_reservation);
+		SetReservation(temporary_memory_state, GetMinimumReservation(temporary_memory_state));
 	} else if (!has_temporary_directory) {
 		// We cannot offload, so we cannot limit memory usage. Set reservation equal to the remaining size
+		auto &resource_group = temporary_memory_state.resource_group;
+		if (resource_group.HasMemoryLimit()) {
+			// The queries of the resource group cannot use more memory than its limit
+			auto group_memory_limit = resource_group.memory_limit.load();
+			auto group_reservation = resource_group.reservation - temporary_memory_state.reservation;
+			if (group_reservation + temporary_memory_state.remaining_size > group_memory_limit) {
+				throw OutOfMemoryException(
+				    "failed to reserve %s of temporary memory: the queries of resource group \"%s\" would use %s of "
+				    "its memory limit of %s, and there is no temporary directory to offload data to",
+				    StringUtil::BytesToHumanReadableString(temporary_memory_state.remaining_size), resource_group.name,
+				    StringUtil::BytesToHumanReadableString(group_reservation + temporary_memory_state.remaining_size),
+				    StringUtil::BytesToHumanReadableString(group_memory_limit));
+			}
+		}
 		SetReservation(temporary_memory_state, temporary_memory_state.remaining_size);
 	} else if (reservation - temporary_memory_state.reservation >= memory_limit) {
 		// We overshot. Set reservation equal to the minimum
-		SetReservation(temporary_memory_state, temporary_memory_state.minimum_reservation);
+		SetReservation(temporary_memory_state, GetMinimumReservation(temporary_memory_state));
 	} else {
 		// The lower bound for the reservation of this state is its minimum reservation
-		auto &lower_bound = temporary_memory_state.minimum_reservation;
+		auto lower_bound = GetMinimumReservation(temporary_memory_state);
 
 		// The upper bound for the reservation of this state is the minimum of:
 		// 1. Remaining size of the state
@@ -94,10 +115,13 @@ void TemporaryMemoryManager::UpdateState(ClientContext &context, TemporaryMemory
 		auto free_memory = memory_limit - (reservation - temporary_memory_state.reservation);
 		upper_bound = MinValue<idx_t>(upper_bound, NumericCast<idx_t>(MAXIMUM_FREE_MEMORY_RATIO * free_memory));
 
+		// 4. The memory limit of the resource group minus what the other states in the group have reserved
+		upper_bound = MinValue<idx_t>(upper_bound, GetResourceGroupFreeMemory(temporary_memory_state));
+
 		if (remaining_size > memory_limit) {
 			// We're processing more data than fits in memory, so we must further limit memory usage.
 			// The upper bound for the reservation of this state is now also the minimum of:
-			// 3. The ratio of the remaining size of this state and the total remaining size * memory limit
+			// 5. The ratio of the remaining size of this state and the total remaining size * memory limit
 			auto ratio_of_remaining = double(temporary_memory_state.remaining_size) / double(remaining_size);
 			upper_bound = MinValue<idx_t>(upper_bound, NumericCast<idx_t>(ratio_of_remaining * memory_limit));
 		}
@@ -108,6 +132,23 @@ void TemporaryMemoryManager::UpdateState(ClientContext &context, TemporaryMemory
 	Verify();
 }
 
+idx_t TemporaryMemoryManager::GetResourceGroupFreeMemory(const TemporaryMemoryState &temporary_memory_state) const {
+	auto &resource_group = temporary_memory_state.resource_group;
+	if (!resource_group.HasMemoryLimit()) {
+		return NumericLimits<idx_t>::Maximum();
+	}
+	auto group_memory_limit = resource_group.memory_limit.load();
+	auto group_reservation = resource_group.reservation - temporary_memory_state.reservation;
+	return group_memory_limit - MinValue(group_memory_limit, group_reservation);
+}
+
+idx_t TemporaryMemoryManager::GetMinimumReservation(const TemporaryMemoryState &temporary_memory_state) const {
+	// The minimum reservations of the states in a resource group count towards its memory limit too:
+	// with many concurrent states, the minimum is reduced to what is left of the limit
+	return MinValue<idx_t>(temporary_memory_state.minimum_reservation,
+	                       GetResourceGroupFreeMemory(temporary_memory_state));
+}
+
 void TemporaryMemoryManager::SetRemainingSize(TemporaryMemoryState &temporary_memory_state, idx_t new_remaining_size) {
 	D_ASSERT(this->remaining_size >= temporary_memory_state.remaining_size);
 	this->remaining_size -= temporary_memory_state.remaining_size;
@@ -117,9 +158,13 @@ void TemporaryMemoryManager::SetRemainingSize(TemporaryMemoryState &temporary_me
 
 void TemporaryMemoryManager::SetReservation(TemporaryMemoryState &temporary_memory_state, idx_t new_reservation) {
 	D_ASSERT(this->reservation >= temporary_memory_state.reservation);
+	auto &resource_group = temporary_memory_state.resource_group;
+	D_ASSERT(resource_group.reservation >= temporary_memory_state.reservation);
 	this->reservation -= temporary_memory_state.reservation;
+	resource_group.reservation -= temporary_memory_state.reservation;
 	temporary_memory_state.reservation = new_reservation;
 	this->reservation += temporary_memory_state.reservation;
+	resource_group.reservation += temporary_memory_state.reservation;
 }
 
 void TemporaryMemoryManager::Unregister(TemporaryMemoryState &temporary_memory_state) {
@@ -28,10 +28,44 @@
 #include "duckdb/main/config.hpp"
 #include "duckdb/storage/table/delete_state.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
+#include "duckdb/transaction/local_storage.hpp"
+#include "duckdb/execution/task_error_manager.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+#include "duckdb/common/reference_map.hpp"
+
+#include <thread>
 
 namespace duckdb {
 
+struct ReplayTaskState;
+
+//! An insert entry of the WAL of which the deserialization is deferred until the pending inserts are flushed
+struct ReplayInsertEntry {
+	ReplayInsertEntry(unique_ptr<data_t[]> data_p, idx_t size_p) : data(std::move(data_p)), size(size_p) {
+	}
+
+	unique_ptr<data_t[]> data;
+	idx_t size;
+	unique_ptr<DataChunk> chunk;
+};
+
+//! The pending inserts into a single table
+struct ReplayTableInserts {
+	explicit ReplayTableInserts(TableCatalogEntry &table) : table(table) {
+	}
+
+	TableCatalogEntry &table;
+	vector<ReplayInsertEntry> entries;
+	LocalAppendState append_state;
+};
+
 class ReplayState {
+public:
+	//! The maximum size of the (serialized) inserts that are buffered before they are appended to the tables
+	static constexpr idx_t MAX_PENDING_INSERT_SIZE = 64ULL * 1024ULL * 1024ULL;
+	//! The number of insert entries that are deserialized by a single task
+	static constexpr idx_t DESERIALIZE_TASK_SIZE = 16;
+
 public:
 	ReplayState(AttachedDatabase &db, ClientContext &context) : db(db), context(context), catalog(db.GetCatalog()) {
 	}
@@ -42,6 +76,21 @@ public:
 	optional_ptr<TableCatalogEntry> current_table;
 	MetaBlockPointer checkpoint_id;
 	idx_t wal_version = 1;
+
+	//! The pending inserts, in the order in which the tables were first encountered
+	vector<unique_ptr<ReplayTableInserts>> pending_inserts;
+	reference_map_t<TableCatalogEntry, idx_t> pending_table_map;
+	idx_t pending_insert_size = 0;
+
+public:
+	//! Defer an insert into the current table
+	void DeferInsert(unique_ptr<data_t[]> data, idx_t size);
+	//! Deserialize the pending inserts and append them to their tables. Inserts into different tables are appended
+	//! in parallel - inserts into the same table are appended in the order in which they appear in the WAL.
+	void FlushInserts();
+
+private:
+	void ExecuteTasks(ReplayTaskState &task_state);
 };
 
 class WriteAheadLogDeserializer {
@@ -99,8 +148,20 @@ public:
 		auto wal_type = deserializer.ReadProperty<WALType>(100, "wal_type");
 		if (wal_type == WALType::WAL_FLUSH) {
 			deserializer.End();
+			if (!DeserializeOnly()) {
+				state.FlushInserts();
+			}
 			return true;
 		}
+		if (wal_type == WALType::INSERT_TUPLE && CanDeferInsert()) {
+			// the insert is deserialized and appended together with the other pending inserts
+			state.DeferInsert(std::move(data), stream.GetCapacity());
+			return false;
+		}
+		if (wal_type != WALType::USE_TABLE && !DeserializeOnly()) {
+			// any other entry is replayed in order - first append all pending inserts
+			state.FlushInserts();
+		}
 		ReplayEntry(wal_type);
 		deserializer.End();
 		return false;
@@ -110,6 +171,17 @@ public:
 		return deserialize_only;
 	}
 
+	//! Inserts can be deferred if we own the (checksummed) entry - i.e. for WAL version 2 and up
+	bool CanDeferInsert() {
+		if (DeserializeOnly() || !data) {
+			return false;
+		}
+		if (!state.current_table) {
+			throw InternalException("Corrupt WAL: insert without table");
+		}
+		return true;
+	}
+
 protected:
 	void ReplayEntry(WALType wal_type);
 
@@ -158,6 +230,202 @@ private:
 	bool deserialize_only;
 };
 
+//===--------------------------------------------------------------------===//
+// Parallel Insert Replay
+//===--------------------------------------------------------------------===//
+struct ReplayTaskState {
+	explicit ReplayTaskState(TaskScheduler &scheduler)
+	    : scheduler(scheduler), token(scheduler.CreateProducer()), completed_tasks(0), total_tasks(0) {
+	}
+
+	TaskScheduler &scheduler;
+	unique_ptr<ProducerToken> token;
+	TaskErrorManager error_manager;
+	atomic<idx_t> completed_tasks;
+	atomic<idx_t> total_tasks;
+
+public:
+	void ScheduleTask(shared_ptr<Task> task) {
+		++total_tasks;
+		scheduler.ScheduleTask(*token, std::move(task));
+	}
+	void WorkOnTasks() {
+		shared_ptr<Task> task;
+		while (scheduler.GetTaskFromProducer(*token, task)) {
+			task->Execute(TaskExecutionMode::PROCESS_ALL);
+			task.reset();
+		}
+	}
+	bool TasksFinished() {
+		return completed_tasks == total_tasks;
+	}
+};
+
+class BaseReplayTask : public Task {
+public:
+	explicit BaseReplayTask(ReplayTaskState &task_state) : task_state(task_state) {
+	}
+
+	virtual void ExecuteTask() = 0;
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		(void)mode;
+		D_ASSERT(mode == TaskExecutionMode::PROCESS_ALL);
+		auto result = TaskExecutionResult::TASK_FINISHED;
+		if (!task_state.error_manager.HasError()) {
+			try {
+				ExecuteTask();
+			} catch (std::exception &ex) {
+				task_state.error_manager.PushError(ErrorData(ex));
+				result = TaskExecutionResult::TASK_ERROR;
+			} catch (...) { // LCOV_EXCL_START
+				task_state.error_manager.PushError(ErrorData("Unknown exception during WAL replay!"));
+				result = TaskExecutionResult::TASK_ERROR;
+			} // LCOV_EXCL_STOP
+		}
+		++task_state.completed_tasks;
+		return result;
+	}
+
+protected:
+	ReplayTaskState &task_state;
+};
+
+//! Deserializes a range of the insert entries of a table
+class ReplayDeserializeTask : public BaseReplayTask {
+public:
+	ReplayDeserializeTask(ReplayTaskState &task_state, ReplayTableInserts &inserts, idx_t start, idx_t end)
+	    : BaseReplayTask(task_state), inserts(inserts), start(start), end(end) {
+	}
+
+	void ExecuteTask() override {
+		for (idx_t i = start; i < end; i++) {
+			auto &entry = inserts.entries[i];
+			MemoryStream stream(entry.data.get(), entry.size);
+			BinaryDeserializer deserializer(stream);
+			deserializer.Begin();
+			auto wal_type = deserializer.ReadProperty<WALType>(100, "wal_type");
+			D_ASSERT(wal_type == WALType::INSERT_TUPLE);
+			(void)wal_type;
+			entry.chunk = make_uniq<DataChunk>();
+			deserializer.ReadObject(101, "chunk", [&](Deserializer &object) { entry.chunk->Deserialize(object); });
+			deserializer.End();
+			// the serialized entry is no longer required
+			entry.data.reset();
+		}
+	}
+
+private:
+	ReplayTableInserts &inserts;
+	idx_t start;
+	idx_t end;
+};
+
+//! Appends the deserialized inserts of a table to its transaction-local storage
+class ReplayAppendTask : public BaseReplayTask {
+public:
+	ReplayAppendTask(ReplayTaskState &task_state, ReplayTableInserts &inserts)
+	    : BaseReplayTask(task_state), inserts(inserts) {
+	}
+
+	void ExecuteTask() override {
+		for (auto &entry : inserts.entries) {
+			// we don't do any constraint verification here
+			// the transaction-local indexes are skipped - the rows are added to the indexes in bulk on commit
+			LocalStorage::Append(inserts.append_state, *entry.chunk, false);
+			entry.chunk.reset();
+		}
+	}
+
+private:
+	ReplayTableInserts &inserts;
+};
+
+void ReplayState::DeferInsert(unique_ptr<data_t[]> data, idx_t size) {
+	D_ASSERT(current_table);
+	auto &table = *current_table;
+	auto entry = pending_table_map.find(table);
+	idx_t table_idx;
+	if (entry == pending_table_map.end()) {
+		table_idx = pending_inserts.size();
+		pending_inserts.push_back(make_uniq<ReplayTableInserts>(table));
+		pending_table_map.insert(make_pair(std::ref(table), table_idx));
+	} else {
+		table_idx = entry->second;
+	}
+	pending_inserts[table_idx]->entries.emplace_back(std::move(data), size);
+	pending_insert_size += size;
+	if (pending_insert_size >= MAX_PENDING_INSERT_SIZE) {
+		FlushInserts();
+	}
+}
+
+void ReplayState::ExecuteTasks(ReplayTaskState &task_state) {
+	auto &scheduler = task_state.scheduler;
+	idx_t task_count = task_state.total_tasks;
+#ifndef DUCKDB_NO_THREADS
+	// the worker threads of the scheduler are only launched after the database has been loaded
+	// if they are not running (yet) we spin up helper threads to replay the WAL with
+	auto &config = DBConfig::GetConfig(context);
+	auto active_threads = NumericCast<idx_t>(scheduler.NumberOfThreads());
+	idx_t helper_count = 0;
+	if (config.options.maximum_threads > active_threads && task_count > 1) {
+		helper_count = MinValue<idx_t>(config.options.maximum_threads - active_threads, task_count - 1);
+	}
+	vector<std::thread> helpers;
+	helpers.reserve(helper_count);
+	for (idx_t i = 0; i < helper_count; i++) {
+		helpers.emplace_back([&task_state]() { task_state.WorkOnTasks(); });
+	}
+#endif
+	do {
+		task_state.WorkOnTasks();
+	} while (!task_state.TasksFinished());
+#ifndef DUCKDB_NO_THREADS
+	for (auto &helper : helpers) {
+		helper.join();
+	}
+#endif
+	if (task_state.error_manager.HasError()) {
+		task_state.error_manager.ThrowException();
+	}
+}
+
+void ReplayState::FlushInserts() {
+	if (pending_inserts.empty()) {
+		return;
+	}
+	auto inserts = std::move(pending_inserts);
+	pending_inserts.clear();
+	pending_table_map.clear();
+	pending_insert_size = 0;
+
+	auto &scheduler = TaskScheduler::GetScheduler(context);
+	// deserialize all pending inserts in parallel
+	ReplayTaskState deserialize_state(scheduler);
+	for (auto &table_inserts : inserts) {
+		auto entry_count = table_inserts->entries.size();
+		for (idx_t start = 0; start < entry_count; start += DESERIALIZE_TASK_SIZE) {
+			auto end = MinValue<idx_t>(start + DESERIALIZE_TASK_SIZE, entry_count);
+			deserialize_state.ScheduleTask(
+			    make_shared_ptr<ReplayDeserializeTask>(deserialize_state, *table_inserts, start, end));
+		}
+	}
+	ExecuteTasks(deserialize_state);
+
+	// append the inserts to their tables - one task per table
+	ReplayTaskState append_state(scheduler);
+	vector<unique_ptr<BoundConstraint>> bound_constraints;
+	for (auto &table_inserts : inserts) {
+		auto &table = table_inserts->table;
+		table.GetStorage().InitializeLocalAppend(table_inserts->append_state, table, context, bound_constraints);
+		append_state.ScheduleTask(make_shared_ptr<ReplayAppendTask>(append_state, *table_inserts));
+	}
+	ExecuteTasks(append_state);
+	for (auto &table_inserts : inserts) {
+		table_inserts->table.GetStorage().FinalizeLocalAppend(table_inserts->append_state);
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Replay
 //===--------------------------------------------------------------------===//
@@ -404,14 +404,55 @@ void WriteAheadLog::Flush() {
 	if (skip_writing) {
 		return;
 	}
+	// flushes all changes made to the WAL to disk
+	Sync(WriteFlush());
+}
+
+idx_t WriteAheadLog::WriteFlush() {
+	D_ASSERT(!skip_writing);
 	D_ASSERT(writer);
 
 	// write an empty entry
 	WriteAheadLogSerializer serializer(*this, WALType::WAL_FLUSH);
 	serializer.End();
 
-	// flushes all changes made to the WAL to disk
-	writer->Sync();
+	// hand the buffered entries to the file system - they are made durable by Sync
+	writer->Flush();
+	lock_guard<mutex> guard(sync_lock);
+	written_position = writer->GetTotalWritten();
+	return written_position;
+}
+
+void WriteAheadLog::Sync(idx_t position) {
+	unique_lock<mutex> guard(sync_lock);
+	while (synced_position < position) {
+		if (sync_failed) {
+			throw FatalException("Failed to sync the write-ahead log: a previous sync failed");
+		}
+		if (sync_in_progress) {
+			// another caller is syncing the WAL - wait for it, the sync might cover our entries as well
+			sync_finished.wait(guard);
+			continue;
+		}
+		// sync everything that has been written so far - including the entries of any concurrent callers
+		auto sync_position = written_position;
+		sync_in_progress = true;
+		guard.unlock();
+		try {
+			writer->handle->Sync();
+		} catch (std::exception &ex) {
+			ErrorData error(ex);
+			guard.lock();
+			sync_in_progress = false;
+			sync_failed = true;
+			sync_finished.notify_all();
+			throw FatalException("Failed to sync the write-ahead log: %s", error.RawMessage());
+		}
+		guard.lock();
+		sync_in_progress = false;
+		synced_position = MaxValue<idx_t>(synced_position, sync_position);
+		sync_finished.notify_all();
+	}
 }
 
 } // namespace duckdb
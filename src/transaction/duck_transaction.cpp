@@ -179,7 +179,6 @@ ErrorData DuckTransaction::Commit(AttachedDatabase &db, transaction_t new_commit
 
 	UndoBuffer::IteratorState iterator_state;
 	LocalStorage::CommitState commit_state;
-	unique_ptr<StorageCommitState> storage_commit_state;
 	optional_ptr<WriteAheadLog> log;
 	if (!db.IsSystem()) {
 		auto &storage_manager = db.GetStorageManager();
@@ -197,6 +196,22 @@ ErrorData DuckTransaction::Commit(AttachedDatabase &db, transaction_t new_commit
 		return ErrorData();
 	} catch (std::exception &ex) {
 		undo_buffer.RevertCommit(iterator_state, this->transaction_id);
+		// destroying the storage commit state reverts anything that was written to the WAL
+		storage_commit_state.reset();
+		return ErrorData(ex);
+	}
+}
+
+ErrorData DuckTransaction::SyncCommit() noexcept {
+	if (!storage_commit_state) {
+		return ErrorData();
+	}
+	try {
+		storage_commit_state->SyncCommit();
+		storage_commit_state.reset();
+		return ErrorData();
+	} catch (std::exception &ex) {
+		storage_commit_state.reset();
 		return ErrorData(ex);
 	}
 }
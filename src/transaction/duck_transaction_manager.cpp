@@ -1,6 +1,7 @@
 #include "duckdb/transaction/duck_transaction_manager.hpp"
 
 #include "duckdb/catalog/catalog_set.hpp"
+#include "duckdb/common/chrono.hpp"
 #include "duckdb/common/exception/transaction_exception.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/helper.hpp"
@@ -13,11 +14,15 @@
 #include "duckdb/main/connection_manager.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/valid_checker.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
 
 namespace duckdb {
 
-DuckTransactionManager::DuckTransactionManager(AttachedDatabase &db) : TransactionManager(db) {
+DuckTransactionManager::DuckTransactionManager(AttachedDatabase &db)
+    : TransactionManager(db), background_checkpoint_requested(false), background_checkpoint_failed_attempts(0),
+      background_checkpoint_pending(false) {
 	// start timestamp starts at two
 	current_start_timestamp = 2;
 	// transaction ID starts very high:
@@ -30,6 +35,7 @@ DuckTransactionManager::DuckTransactionManager(AttachedDatabase &db) : Transacti
 }
 
 DuckTransactionManager::~DuckTransactionManager() {
+	D_ASSERT(!background_checkpoint_pending);
 }
 
 DuckTransactionManager &DuckTransactionManager::Get(AttachedDatabase &db) {
@@ -92,6 +98,12 @@ DuckTransactionManager::CanCheckpoint(DuckTransaction &transaction, unique_ptr<S
 	if (!transaction.AutomaticCheckpoint(db, undo_properties)) {
 		return CheckpointDecision("no reason to automatically checkpoint");
 	}
+	if (CheckpointInBackground()) {
+		// commit to the WAL as usual - the checkpoint is performed by a background thread after the commit
+		CheckpointDecision decision("automatic checkpoint is performed in the background");
+		decision.schedule_background_checkpoint = true;
+		return decision;
+	}
 	// try to lock the checkpoint lock
 	lock = transaction.TryGetCheckpointLock();
 	if (!lock) {
@@ -186,6 +198,129 @@ void DuckTransactionManager::Checkpoint(ClientContext &context, bool force) {
 	storage_manager.CreateCheckpoint(options);
 }
 
+class BackgroundCheckpointTask : public Task {
+public:
+	explicit BackgroundCheckpointTask(DuckTransactionManager &transaction_manager)
+	    : transaction_manager(transaction_manager) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		transaction_manager.BackgroundCheckpoint();
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	DuckTransactionManager &transaction_manager;
+};
+
+bool DuckTransactionManager::CheckpointInBackground() {
+	auto &instance = db.GetDatabase();
+	auto &config = DBConfig::GetConfig(instance);
+	if (!config.options.background_checkpoint) {
+		return false;
+	}
+	// we need background threads to run the checkpoint on
+	auto &scheduler = TaskScheduler::GetScheduler(instance);
+	return NumericCast<idx_t>(scheduler.NumberOfThreads()) > config.options.external_threads;
+}
+
+void DuckTransactionManager::ScheduleBackgroundCheckpoint() {
+	lock_guard<mutex> guard(background_checkpoint_lock);
+	if (background_checkpoint_pending) {
+		// a background checkpoint is already scheduled or running - it might not cover this commit, so we request
+		// another one after it
+		background_checkpoint_requested = true;
+		return;
+	}
+	auto &scheduler = TaskScheduler::GetScheduler(db.GetDatabase());
+	if (!background_checkpoint_producer) {
+		background_checkpoint_producer = scheduler.CreateProducer();
+	}
+	background_checkpoint_pending = true;
+	scheduler.ScheduleTask(*background_checkpoint_producer, make_shared_ptr<BackgroundCheckpointTask>(*this));
+}
+
+//! The number of background checkpoints that can fail to obtain the checkpoint lock before we force one
+static constexpr idx_t BACKGROUND_CHECKPOINT_MAX_FAILED_ATTEMPTS = 8;
+//! The maximum time (in milliseconds) a forced background checkpoint keeps new transactions from starting
+static constexpr int64_t BACKGROUND_CHECKPOINT_MAX_WAIT_MS = 1000;
+
+unique_ptr<StorageLockKey> DuckTransactionManager::ForceBackgroundCheckpointLock() {
+	// grab the start_transaction_lock to prevent new transactions from starting, as FORCE CHECKPOINT does
+	// unlike FORCE CHECKPOINT we do not wait indefinitely: a long-running write transaction would block all clients
+	lock_guard<mutex> start_lock(start_transaction_lock);
+	auto start_time = std::chrono::steady_clock::now();
+	while (!ValidChecker::IsInvalidated(db.GetDatabase())) {
+		auto lock = checkpoint_lock.TryGetExclusiveLock();
+		if (lock) {
+			return lock;
+		}
+		auto elapsed = std::chrono::steady_clock::now() - start_time;
+		if (std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count() >=
+		    BACKGROUND_CHECKPOINT_MAX_WAIT_MS) {
+			break;
+		}
+		TaskScheduler::YieldThread();
+	}
+	return nullptr;
+}
+
+void DuckTransactionManager::BackgroundCheckpoint() {
+	D_ASSERT(background_checkpoint_pending);
+	try {
+		// try to get the checkpoint lock
+		// if we cannot get it there are active write transactions - the next commit that finds the WAL over the
+		// threshold schedules a new background checkpoint
+		auto lock = checkpoint_lock.TryGetExclusiveLock();
+		if (!lock && ++background_checkpoint_failed_attempts >= BACKGROUND_CHECKPOINT_MAX_FAILED_ATTEMPTS) {
+			// writers keep committing while we try to checkpoint, and the WAL keeps growing: wait for the active
+			// write transactions to finish while new transactions cannot start
+			background_checkpoint_failed_attempts = 0;
+			lock = ForceBackgroundCheckpointLock();
+		}
+		if (lock && !ValidChecker::IsInvalidated(db.GetDatabase())) {
+			background_checkpoint_failed_attempts = 0;
+			CheckpointOptions options;
+			if (GetLastCommit() > LowestActiveStart()) {
+				// we cannot do a full checkpoint if any transaction needs to read old data
+				options.type = CheckpointType::CONCURRENT_CHECKPOINT;
+			}
+			db.GetStorageManager().CreateCheckpoint(options);
+		}
+	} catch (std::exception &ex) {
+		// there is no client to report the error to - but a failed checkpoint still invalidates the database
+		ErrorData error(ex);
+		if (Exception::InvalidatesDatabase(error.Type())) {
+			ValidChecker::Invalidate(db.GetDatabase(), error.RawMessage());
+		}
+	} catch (...) { // LCOV_EXCL_START
+	}               // LCOV_EXCL_STOP
+	lock_guard<mutex> guard(background_checkpoint_lock);
+	if (background_checkpoint_requested && !ValidChecker::IsInvalidated(db.GetDatabase()) &&
+	    db.GetStorageManager().AutomaticCheckpoint(0)) {
+		// transactions have committed while we were checkpointing, and the WAL is (still) over the threshold
+		background_checkpoint_requested = false;
+		auto &scheduler = TaskScheduler::GetScheduler(db.GetDatabase());
+		scheduler.ScheduleTask(*background_checkpoint_producer, make_shared_ptr<BackgroundCheckpointTask>(*this));
+		return;
+	}
+	background_checkpoint_requested = false;
+	background_checkpoint_pending = false;
+}
+
+void DuckTransactionManager::WaitForBackgroundCheckpoint() {
+	while (background_checkpoint_pending) {
+		// if no background thread has picked up the checkpoint yet we run it ourselves
+		shared_ptr<Task> task;
+		auto &scheduler = TaskScheduler::GetScheduler(db.GetDatabase());
+		if (scheduler.GetTaskFromProducer(*background_checkpoint_producer, task)) {
+			task->Execute(TaskExecutionMode::PROCESS_ALL);
+		} else {
+			TaskScheduler::YieldThread();
+		}
+	}
+}
+
 unique_ptr<StorageLockKey> DuckTransactionManager::SharedCheckpointLock() {
 	return checkpoint_lock.GetSharedLock();
 }
@@ -225,6 +360,17 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 		checkpoint_decision = CheckpointDecision(error.Message());
 		transaction.commit_id = 0;
 		transaction.Rollback();
+	} else if (!checkpoint_decision.can_checkpoint) {
+		// make the commit durable
+		// we release the transaction lock while waiting for the WAL to be synced: concurrent commits can write their
+		// entries to the WAL in the meantime, and are then made durable together by a single sync
+		tlock.unlock();
+		error = transaction.SyncCommit();
+		tlock.lock();
+		if (error.HasError()) {
+			// the transaction has already been committed in memory, we can no longer roll it back
+			checkpoint_decision = CheckpointDecision(error.Message());
+		}
 	}
 	OnCommitCheckpointDecision(checkpoint_decision, transaction);
 
@@ -237,6 +383,10 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 	// potentially resulting in garbage collection
 	bool store_transaction = undo_properties.has_updates || undo_properties.has_catalog_changes || error.HasError();
 	RemoveTransaction(transaction, store_transaction);
+	if (checkpoint_decision.schedule_background_checkpoint) {
+		// the WAL has reached sufficient size to checkpoint - hand off the checkpoint to a background thread
+		ScheduleBackgroundCheckpoint();
+	}
 	// now perform a checkpoint if (1) we are able to checkpoint, and (2) the WAL has reached sufficient size to
 	// checkpoint
 	if (checkpoint_decision.can_checkpoint) {
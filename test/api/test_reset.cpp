@@ -47,6 +47,7 @@ OptionValueSet &GetValueForOption(const string &name) {
 	static unordered_map<string, OptionValueSet> value_map = {
 	    {"threads", {Value::BIGINT(42), Value::BIGINT(42)}},
 	    {"checkpoint_threshold", {"4.0 GiB"}},
+	    {"background_checkpoint", {true}},
 	    {"debug_checkpoint_abort", {{"none", "before_truncate", "before_header", "after_free_list_write"}}},
 	    {"default_collation", {"nocase"}},
 	    {"default_order", {"desc"}},
@@ -106,6 +107,7 @@ OptionValueSet &GetValueForOption(const string &name) {
 	    {"enable_progress_bar_print", {false}},
 	    {"progress_bar_time", {0}},
 	    {"temp_directory", {"tmp"}},
+	    {"temp_file_compression", {true}},
 	    {"wal_autocheckpoint", {"4.0 GiB"}},
 	    {"worker_threads", {42}},
 	    {"enable_http_metadata_cache", {true}},
@@ -135,6 +137,8 @@ bool OptionIsExcludedFromTest(const string &name) {
 	    "allow_unsigned_extensions",  // cant change this while db is running
 	    "allow_community_extensions", // cant change this while db is running
 	    "allow_unredacted_secrets",   // cant change this while db is running
+	    "numa_affinity",              // cant change this while db is running
+	    "resource_group",             // the resource group has to exist
 	    "log_query_path",
 	    "password",
 	    "username",
@@ -1,5 +1,6 @@
 #include "catch.hpp"
 #include "test_helpers.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 
 #include <thread>
 
@@ -115,3 +116,28 @@ TEST_CASE("Test external threads", "[api]") {
 	REQUIRE(config.options.maximum_threads == std::thread::hardware_concurrency());
 	REQUIRE(db.NumberOfThreads() == std::thread::hardware_concurrency());
 }
+
+TEST_CASE("Test NUMA affinity", "[api]") {
+	DBConfig config;
+	config.options.maximum_threads = 8;
+	config.options.numa_affinity = true;
+	DuckDB db(nullptr, &config);
+	Connection con(db);
+	REQUIRE(db.NumberOfThreads() == 8);
+	REQUIRE(TaskScheduler::GetScheduler(*db.instance).NumberOfNodes() >= 1);
+
+	// tasks are scheduled regardless of the number of nodes of this system
+	auto result = con.Query("SELECT SUM(i), COUNT(DISTINCT i % 1000) FROM range(10000000) t(i)");
+	REQUIRE(CHECK_COLUMN(result, 0, {Value::HUGEINT(49999995000000)}));
+	REQUIRE(CHECK_COLUMN(result, 1, {1000}));
+
+	con.Query("SET threads=3");
+	REQUIRE(db.NumberOfThreads() == 3);
+	result = con.Query("SELECT COUNT(*) FROM range(10000000) t1(i) JOIN range(1000000) t2(i) USING (i)");
+	REQUIRE(CHECK_COLUMN(result, 0, {1000000}));
+
+	// the affinity can only be set on startup
+	REQUIRE_FAIL(con.Query("SET numa_affinity=false"));
+	result = con.Query("SELECT current_setting('numa_affinity')");
+	REQUIRE(CHECK_COLUMN(result, 0, {true}));
+}
@@ -3,6 +3,7 @@
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/storage/storage_info.hpp"
+#include "duckdb/storage/temporary_memory_manager.hpp"
 #include "test_helpers.hpp"
 
 using namespace duckdb;
@@ -330,3 +331,47 @@ TEST_CASE("Test buffer allocator", "[storage][.]") {
 
 	allocator.FreeData(pointer, current_size);
 }
+
+TEST_CASE("Test temporary memory reservations in a resource group with a memory limit", "[storage]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+	REQUIRE_NO_FAIL(con.Query("PRAGMA temp_directory='" + TestCreatePath("resource_group_tmp") + "'"));
+
+	const idx_t group_memory_limit = 10000000;
+	REQUIRE_NO_FAIL(con.Query(
+	    StringUtil::Format("PRAGMA create_resource_group('capped', memory_limit='%lldB')", group_memory_limit)));
+	REQUIRE_NO_FAIL(con.Query("SET resource_group='capped'"));
+
+	// register more states (i.e., operators) than the minimum reservations of the group have room for
+	auto &context = *con.context;
+	auto &temporary_memory_manager = TemporaryMemoryManager::Get(context);
+	duckdb::vector<duckdb::unique_ptr<TemporaryMemoryState>> states;
+	idx_t total_reservation = 0;
+	for (idx_t i = 0; i < 32; i++) {
+		states.push_back(temporary_memory_manager.Register(context));
+		total_reservation += states.back()->GetReservation();
+	}
+	CHECK(total_reservation <= group_memory_limit);
+
+	// the states want more memory than the limit of the group, together and individually
+	for (auto &state : states) {
+		state->SetRemainingSize(context, 100 * group_memory_limit);
+	}
+	total_reservation = 0;
+	for (auto &state : states) {
+		total_reservation += state->GetReservation();
+	}
+	CHECK(total_reservation <= group_memory_limit);
+
+	// memory that is released can be reserved by the remaining states
+	states.resize(states.size() / 2);
+	for (auto &state : states) {
+		state->SetRemainingSize(context, 100 * group_memory_limit);
+	}
+	total_reservation = 0;
+	for (auto &state : states) {
+		total_reservation += state->GetReservation();
+	}
+	CHECK(total_reservation <= group_memory_limit);
+	CHECK(total_reservation > 0);
+}